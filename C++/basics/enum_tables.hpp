@@ -0,0 +1,186 @@
+// C++ Compile-Time Enum Tables Summary
+//
+// enums.cpp turns enums into text (and picks actions) with switch statements.
+// Here each enum is listed ONCE as {value, "NAME"} pairs, and constexpr code
+// builds everything else while the program COMPILES:
+//   - to_string:   array indexed by value           -> one load, no switch
+//   - from_string: perfect hash (seed found by the compiler) -> one probe + compare
+//   - handlers:    array of function pointers       -> one indirect call, no switch
+//
+// static_assert stops the build if a table is broken (duplicate names or
+// values, no collision-free hash seed, a missing handler).
+// The C version (C/enum_tables.h) uses X-macros and finds its hash seed at startup.
+//
+// Needs C++17 (constexpr loops, std::string_view, std::optional, auto template params):
+//   g++ -std=c++17 -O2 -o main basics/enum_tables_bench.cpp && ./main
+
+#ifndef ENUM_TABLES_HPP
+#define ENUM_TABLES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+template <typename E>
+struct EnumEntry {
+    E value;
+    std::string_view name;
+};
+
+namespace enum_detail {
+    // Same hash as C/enum_tables.c: first 4 bytes ^ last 4 bytes ^ length, times a seed
+    constexpr uint32_t load_upto4(std::string_view s, size_t from) {
+        uint32_t x = 0;
+        for (size_t i = 0; i < 4 && from + i < s.size(); i++) {
+            x |= uint32_t(static_cast<unsigned char>(s[from + i])) << (8 * i);
+        }
+        return x;
+    }
+
+    constexpr uint32_t name_hash(uint32_t seed, std::string_view s, int bits) {
+        uint32_t head = load_upto4(s, 0);
+        uint32_t tail = s.size() >= 4 ? load_upto4(s, s.size() - 4) : head;
+        return ((head ^ (tail << 1) ^ uint32_t(s.size())) * seed) >> (32 - bits);
+    }
+}
+
+// Values must span at most Span integers (max - min + 1)
+template <typename E, size_t N, size_t Span>
+class EnumTable {
+public:
+    using Underlying = std::underlying_type_t<E>;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t(1) << SLOT_BITS;
+    static_assert(N > 0 && N < SLOTS, "enum must have 1..63 values");
+
+    constexpr explicit EnumTable(const std::array<EnumEntry<E>, N> &entries) : entries_(entries) {
+        min_ = Underlying(entries[0].value);
+        for (const auto &e : entries) {
+            if (Underlying(e.value) < min_) min_ = Underlying(e.value);
+        }
+        for (size_t i = 0; i < N; i++) {
+            size_t index = size_t(Underlying(entries[i].value) - min_);
+            if (index >= Span || !names_[index].empty()) valid_ = false;   // Out of range or duplicate value
+            else names_[index] = entries[i].name;
+            for (size_t j = 0; j < i; j++) {
+                if (entries[j].name == entries[i].name) valid_ = false;      // Duplicate name
+            }
+        }
+        find_seed();
+    }
+
+    // "" if e isn't one of the values
+    constexpr std::string_view to_string(E e) const {
+        size_t i = index(e);
+        return i < Span ? names_[i] : std::string_view();
+    }
+
+    constexpr std::optional<E> from_string(std::string_view s) const {
+        int i = slots_[enum_detail::name_hash(seed_, s, SLOT_BITS)];
+        if (i < 0 || entries_[i].name != s) return std::nullopt;
+        return entries_[i].value;
+    }
+
+    // Position of e in a Span-sized table (>= Span if e isn't a value)
+    constexpr size_t index(E e) const {
+        return size_t(Underlying(e) - min_);
+    }
+
+    // Dense handler table: result[index(e)] = the handler given for e
+    template <typename Fn>
+    constexpr std::array<Fn, Span> handlers(const std::array<std::pair<E, Fn>, N> &list) const {
+        std::array<Fn, Span> table{};
+        for (const auto &[value, fn] : list) table[index(value)] = fn;
+        return table;
+    }
+
+    constexpr bool valid() const { return valid_ && seed_ != 0; }
+    constexpr const std::array<EnumEntry<E>, N>& entries() const { return entries_; }
+
+private:
+    // Try seeds until every name hashes to its own slot (runs in the compiler)
+    constexpr void find_seed() {
+        for (uint32_t seed = 0x9E3779B1u, tries = 0; tries < 10000; seed += 0x6A09E667u, tries++) {
+            std::array<int8_t, SLOTS> slots{};
+            for (auto &s : slots) s = -1;
+            bool collision = false;
+            for (size_t i = 0; i < N && !collision; i++) {
+                uint32_t h = enum_detail::name_hash(seed | 1, entries_[i].name, SLOT_BITS);
+                if (slots[h] >= 0) collision = true;
+                else slots[h] = int8_t(i);
+            }
+            if (!collision) {
+                seed_ = seed | 1;
+                slots_ = slots;
+                return;
+            }
+        }
+    }
+
+    std::array<EnumEntry<E>, N> entries_;
+    std::array<std::string_view, Span> names_{};
+    std::array<int8_t, SLOTS> slots_{};
+    Underlying min_{};
+    uint32_t seed_ = 0;
+    bool valid_ = true;
+};
+
+template <typename E, size_t N>
+constexpr size_t enum_span(const std::array<EnumEntry<E>, N> &entries) {
+    auto lo = std::underlying_type_t<E>(entries[0].value), hi = lo;
+    for (const auto &e : entries) {
+        auto v = std::underlying_type_t<E>(e.value);
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    return size_t(hi - lo) + 1;
+}
+
+// make_enum_table<entries>() sizes the table from the entries themselves
+template <const auto &Entries>
+constexpr auto make_enum_table() {
+    using E = std::remove_cv_t<decltype(Entries[0].value)>;
+    return EnumTable<E, Entries.size(), enum_span(Entries)>(Entries);
+}
+
+// True if every slot of a handler table was filled
+template <typename Fn, size_t Span>
+constexpr bool all_handled(const std::array<Fn, Span> &table, size_t used) {
+    size_t filled = 0;
+    for (const auto &fn : table) filled += fn != nullptr;
+    return filled == used;
+}
+
+// ===== THE ENUMS (same as enums.cpp) =====
+
+enum class Priority { LOW, MEDIUM, HIGH };
+
+enum class Grade : char { A = 'A', B = 'B', C = 'C', D = 'D', F = 'F' };
+
+enum class Status { PENDING = 1, APPROVED = 2, REJECTED = 3 };
+
+inline constexpr std::array<EnumEntry<Priority>, 3> priority_entries{{
+    {Priority::LOW, "LOW"}, {Priority::MEDIUM, "MEDIUM"}, {Priority::HIGH, "HIGH"},
+}};
+inline constexpr std::array<EnumEntry<Grade>, 5> grade_entries{{
+    {Grade::A, "A"}, {Grade::B, "B"}, {Grade::C, "C"}, {Grade::D, "D"}, {Grade::F, "F"},
+}};
+inline constexpr std::array<EnumEntry<Status>, 3> status_entries{{
+    {Status::PENDING, "PENDING"}, {Status::APPROVED, "APPROVED"}, {Status::REJECTED, "REJECTED"},
+}};
+
+inline constexpr auto priority_table = make_enum_table<priority_entries>();
+inline constexpr auto grade_table = make_enum_table<grade_entries>();   // Span 6: 'E' is a gap
+inline constexpr auto status_table = make_enum_table<status_entries>();
+
+static_assert(priority_table.valid(), "Priority table: duplicate or hash collision");
+static_assert(grade_table.valid(), "Grade table: duplicate or hash collision");
+static_assert(status_table.valid(), "Status table: duplicate or hash collision");
+static_assert(status_table.from_string("APPROVED") == Status::APPROVED, "computed by the compiler");
+static_assert(grade_table.to_string(Grade::F) == "F");
+
+#endif
@@ -0,0 +1,117 @@
+// C++ Enum Tables Benchmark
+//
+// N random values of the enums from enums.cpp:
+//   1. enum -> string:  switch vs priority_table.to_string (array lookup)
+//   2. string -> enum:  if-chain of == vs status_table.from_string (compile-time perfect hash)
+//   3. enum -> action:  switch vs constexpr handler table
+// With only 3 names the if-chain is already short, so expect a tie on 2 -
+// the hash costs the same however many names the enum gets.
+//
+// g++ -std=c++17 -O2 -o main basics/enum_tables_bench.cpp && ./main [count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "enum_tables.hpp"
+
+using namespace std;
+
+static double now_sec() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void report(const char *name, double seconds, size_t count) {
+    printf("  %-30s %8.2f ms  %7.1f M/s\n", name, seconds * 1e3, count / seconds / 1e6);
+}
+
+// ===== HAND-WRITTEN VERSIONS =====
+
+static string_view priority_to_string_switch(Priority p) {
+    switch (p) {
+        case Priority::LOW: return "LOW";
+        case Priority::MEDIUM: return "MEDIUM";
+        case Priority::HIGH: return "HIGH";
+    }
+    return "";
+}
+
+static optional<Status> status_from_string_chain(string_view s) {
+    if (s == "PENDING") return Status::PENDING;
+    if (s == "APPROVED") return Status::APPROVED;
+    if (s == "REJECTED") return Status::REJECTED;
+    return nullopt;
+}
+
+// ===== HANDLERS =====
+
+struct Counters {
+    long low = 0, medium = 0, high = 0;
+};
+
+using Handler = void (*)(Counters &);
+static void on_low(Counters &c) { c.low++; }
+static void on_medium(Counters &c) { c.medium++; }
+static void on_high(Counters &c) { c.high++; }
+
+static constexpr auto priority_handlers = priority_table.handlers<Handler>({{
+    {Priority::LOW, on_low}, {Priority::MEDIUM, on_medium}, {Priority::HIGH, on_high},
+}});
+static_assert(all_handled(priority_handlers, priority_entries.size()), "every Priority needs a handler");
+
+static void dispatch_switch(Priority p, Counters &c) {
+    switch (p) {
+        case Priority::LOW: on_low(c); break;
+        case Priority::MEDIUM: on_medium(c); break;
+        case Priority::HIGH: on_high(c); break;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    if (count == 0) count = 1;
+
+    vector<Priority> priorities(count);
+    vector<string> words(count);
+    unsigned seed = 1;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245u + 12345u;
+        priorities[i] = priority_entries[(seed >> 16) % 3].value;
+        words[i] = string(status_entries[(seed >> 8) % 3].name);
+    }
+
+    printf("%zu random values\n\n", count);
+    size_t check = 0;
+
+    printf("enum -> string (Priority):\n");
+    double start = now_sec();
+    for (Priority p : priorities) check += priority_to_string_switch(p).size();
+    report("switch", now_sec() - start, count);
+    start = now_sec();
+    for (Priority p : priorities) check -= priority_table.to_string(p).size();
+    report("priority_table.to_string", now_sec() - start, count);
+
+    printf("string -> enum (Status):\n");
+    start = now_sec();
+    for (const string &w : words) check += size_t(*status_from_string_chain(w));
+    report("if-chain ==", now_sec() - start, count);
+    start = now_sec();
+    for (const string &w : words) check -= size_t(*status_table.from_string(w));
+    report("status_table.from_string", now_sec() - start, count);
+
+    printf("enum -> handler (Priority):\n");
+    Counters a, b;
+    start = now_sec();
+    for (Priority p : priorities) dispatch_switch(p, a);
+    report("switch", now_sec() - start, count);
+    start = now_sec();
+    for (Priority p : priorities) priority_handlers[priority_table.index(p)](b);
+    report("priority_handlers table", now_sec() - start, count);
+
+    bool same = check == 0 && a.low == b.low && a.medium == b.medium && a.high == b.high;
+    printf("\n%s\n", same ? "all versions agree" : "MISMATCH between versions!");
+    return 0;
+}
@@ -0,0 +1,312 @@
+// C++ FlatMap / FlatSet Summary
+//
+// Sorted-vector versions of std::map and std::set (c06_maps.cpp, c07_sets.cpp)
+// with the same surface: [], at, insert, erase, count, find, size, empty, clear,
+// and sorted for-each loops.
+//
+// Why: map<string, int> allocates one tree node per element, and every lookup
+// follows ~log2(N) pointers to nodes scattered around the heap. FlatMap keeps its
+// pairs in ONE sorted array:
+//   - lookups are a binary search over contiguous memory (no pointer chasing)
+//   - for int/double/pointer keys the search is BRANCHLESS: each step picks the
+//     half with a conditional move, so there is no 50/50 branch to mispredict
+//   - looping is a straight walk through an array
+//   - one allocation for the whole map instead of one per element
+// The price: insert and erase in the middle shift everything after them, O(N).
+// Best for read-mostly dictionaries: build once (bulk-build from unsorted input
+// is a single sort, O(N log N)), then look up many times.
+//
+//   FlatMap<string, int> people = { {"John", 32}, {"Adele", 45}, {"Bo", 29} };
+//   people["Jenny"] = 22;
+//   FlatMap<string, int> ages(unsorted_pairs);          // sort + drop duplicate keys
+//
+// Unlike std::map, insert/erase invalidate iterators and references (it's a vector),
+// and the keys are not const: don't change a key in place.
+//
+// Needs C++17:
+//   g++ -std=c++17 -O2 -o main datastructures/flat_map_bench.cpp && ./main
+
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace flat_detail {
+	// First element in [first, first + count) whose key is not less than `key`.
+	//
+	// Scalar keys (int, double, pointers...): BRANCHLESS. `first` moves by half or by
+	// nothing (a cmov) and the loop runs ~log2(count) times whatever the key, so there
+	// is no 50/50 branch to mispredict. Without a branch the CPU can't guess ahead,
+	// so on big arrays both possible next midpoints are prefetched instead.
+	//
+	// Other keys (string...): the usual branchy search. A string compare already
+	// branches and follows a pointer to the characters; there, letting the CPU
+	// speculate down the likely half beats waiting for each compare (see the bench).
+	template <typename T, typename Key, typename KeyOf, typename Less>
+	const T* lower_bound(const T *first, size_t count, const Key &key, KeyOf key_of, const Less &less) {
+		using K = std::decay_t<decltype(key_of(*first))>;
+		if constexpr (std::is_scalar_v<K>) {
+			if (count == 0) return first;
+			while (count > 1) {
+				size_t half = count / 2;
+#if defined(__GNUC__) || defined(__clang__)
+				if (half * sizeof(T) >= 4096) {   // Beyond a page: the next step is a cache miss
+					__builtin_prefetch(first + half / 2);
+					__builtin_prefetch(first + half + half / 2);
+				}
+#endif
+				first = less(key_of(first[half]), key) ? first + half : first;
+				count -= half;
+			}
+			return first + less(key_of(*first), key);
+		} else {
+			while (count > 0) {
+				size_t half = count / 2;
+				if (less(key_of(first[half]), key)) {
+					first += half + 1;
+					count -= half + 1;
+				} else {
+					count = half;
+				}
+			}
+			return first;
+		}
+	}
+
+	// Sort by key and keep the FIRST of equal keys, like inserting them one by one
+	template <typename T, typename KeyOf, typename Less>
+	void sort_unique(std::vector<T> &items, KeyOf key_of, const Less &less) {
+		auto by_key = [&](const T &a, const T &b) { return less(key_of(a), key_of(b)); };
+		if (!std::is_sorted(items.begin(), items.end(), by_key)) std::stable_sort(items.begin(), items.end(), by_key);
+		auto same = [&](const T &a, const T &b) { return !by_key(a, b) && !by_key(b, a); };
+		items.erase(std::unique(items.begin(), items.end(), same), items.end());
+	}
+}
+
+// ===== FLAT MAP =====
+
+// Compare = std::less<> lets find("John") compare against a const char* directly
+template <typename K, typename V, typename Compare = std::less<>>
+class FlatMap {
+public:
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<K, V>;
+	using iterator = typename std::vector<value_type>::iterator;
+	using const_iterator = typename std::vector<value_type>::const_iterator;
+
+	FlatMap() = default;
+	FlatMap(std::initializer_list<value_type> items) : items_(items) { sort_unique(); }
+
+	// Bulk build: one sort instead of N inserts
+	explicit FlatMap(std::vector<value_type> items) : items_(std::move(items)) { sort_unique(); }
+
+	template <typename It>
+	FlatMap(It first, It last) : items_(first, last) { sort_unique(); }
+
+	FlatMap& operator=(std::initializer_list<value_type> items) {
+		items_.assign(items);
+		sort_unique();
+		return *this;
+	}
+
+	// ===== ACCESS =====
+
+	// Inserts V() if the key is missing, like std::map
+	V& operator[](const K &key) { return try_emplace(key).first->second; }
+	V& operator[](K &&key) { return try_emplace(std::move(key)).first->second; }
+
+	template <typename Key>
+	V& at(const Key &key) {
+		iterator it = find(key);
+		if (it == end()) throw std::out_of_range("FlatMap::at");
+		return it->second;
+	}
+	template <typename Key>
+	const V& at(const Key &key) const {
+		const_iterator it = find(key);
+		if (it == end()) throw std::out_of_range("FlatMap::at");
+		return it->second;
+	}
+
+	// ===== LOOKUP =====
+
+	template <typename Key>
+	iterator lower_bound(const Key &key) { return begin() + position(key); }
+	template <typename Key>
+	const_iterator lower_bound(const Key &key) const { return begin() + position(key); }
+
+	template <typename Key>
+	iterator find(const Key &key) {
+		size_t i = position(key);
+		return i < items_.size() && !less_(key, items_[i].first) ? begin() + i : end();
+	}
+	template <typename Key>
+	const_iterator find(const Key &key) const {
+		size_t i = position(key);
+		return i < items_.size() && !less_(key, items_[i].first) ? begin() + i : end();
+	}
+
+	template <typename Key>
+	size_t count(const Key &key) const { return find(key) != end(); }
+	template <typename Key>
+	bool contains(const Key &key) const { return find(key) != end(); }
+
+	// ===== MODIFY =====
+
+	// Does nothing if the key is already there (returns it with false), like std::map
+	std::pair<iterator, bool> insert(const value_type &item) { return try_emplace(item.first, item.second); }
+	std::pair<iterator, bool> insert(value_type &&item) {
+		return try_emplace(std::move(item.first), std::move(item.second));
+	}
+
+	template <typename Key, typename... Args>
+	std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+		size_t i = position(key);
+		if (i < items_.size() && !less_(key, items_[i].first)) return {begin() + i, false};
+		iterator it = items_.emplace(begin() + i, std::piecewise_construct,
+		                             std::forward_as_tuple(std::forward<Key>(key)),
+		                             std::forward_as_tuple(std::forward<Args>(args)...));
+		return {it, true};
+	}
+
+	template <typename Key, typename Value>
+	std::pair<iterator, bool> insert_or_assign(Key &&key, Value &&value) {
+		auto [it, inserted] = try_emplace(std::forward<Key>(key), std::forward<Value>(value));
+		if (!inserted) it->second = std::forward<Value>(value);
+		return {it, inserted};
+	}
+
+	// Number of elements removed (0 or 1)
+	template <typename Key>
+	size_t erase(const Key &key) {
+		iterator it = find(key);
+		if (it == end()) return 0;
+		items_.erase(it);
+		return 1;
+	}
+	iterator erase(iterator it) { return items_.erase(it); }
+	iterator erase(const_iterator it) { return items_.erase(it); }
+
+	void clear() noexcept { items_.clear(); }
+	void reserve(size_t count) { items_.reserve(count); }
+
+	// ===== SIZE / ITERATE =====
+
+	size_t size() const noexcept { return items_.size(); }
+	bool empty() const noexcept { return items_.empty(); }
+
+	iterator begin() noexcept { return items_.begin(); }
+	iterator end() noexcept { return items_.end(); }
+	const_iterator begin() const noexcept { return items_.begin(); }
+	const_iterator end() const noexcept { return items_.end(); }
+
+private:
+	static const K& key_of(const value_type &item) { return item.first; }
+
+	template <typename Key>
+	size_t position(const Key &key) const {
+		return flat_detail::lower_bound(items_.data(), items_.size(), key, key_of, less_) - items_.data();
+	}
+
+	void sort_unique() { flat_detail::sort_unique(items_, key_of, less_); }
+
+	std::vector<value_type> items_;
+	Compare less_;
+};
+
+// ===== FLAT SET =====
+
+template <typename K, typename Compare = std::less<>>
+class FlatSet {
+public:
+	using key_type = K;
+	using value_type = K;
+	// Elements are sorted: only const access, like std::set
+	using iterator = typename std::vector<K>::const_iterator;
+	using const_iterator = iterator;
+
+	FlatSet() = default;
+	FlatSet(std::initializer_list<K> items) : items_(items) { sort_unique(); }
+	explicit FlatSet(std::vector<K> items) : items_(std::move(items)) { sort_unique(); }
+
+	template <typename It>
+	FlatSet(It first, It last) : items_(first, last) { sort_unique(); }
+
+	FlatSet& operator=(std::initializer_list<K> items) {
+		items_.assign(items);
+		sort_unique();
+		return *this;
+	}
+
+	// ===== LOOKUP =====
+
+	template <typename Key>
+	iterator lower_bound(const Key &key) const { return begin() + position(key); }
+
+	template <typename Key>
+	iterator find(const Key &key) const {
+		size_t i = position(key);
+		return i < items_.size() && !less_(key, items_[i]) ? begin() + i : end();
+	}
+
+	template <typename Key>
+	size_t count(const Key &key) const { return find(key) != end(); }
+	template <typename Key>
+	bool contains(const Key &key) const { return find(key) != end(); }
+
+	// ===== MODIFY =====
+
+	std::pair<iterator, bool> insert(const K &key) { return emplace(key); }
+	std::pair<iterator, bool> insert(K &&key) { return emplace(std::move(key)); }
+
+	template <typename Key>
+	std::pair<iterator, bool> emplace(Key &&key) {
+		size_t i = position(key);
+		if (i < items_.size() && !less_(key, items_[i])) return {begin() + i, false};
+		return {items_.emplace(items_.begin() + i, std::forward<Key>(key)), true};
+	}
+
+	template <typename Key>
+	size_t erase(const Key &key) {
+		iterator it = find(key);
+		if (it == end()) return 0;
+		items_.erase(it);
+		return 1;
+	}
+	iterator erase(const_iterator it) { return items_.erase(it); }
+
+	void clear() noexcept { items_.clear(); }
+	void reserve(size_t count) { items_.reserve(count); }
+
+	// ===== SIZE / ITERATE =====
+
+	size_t size() const noexcept { return items_.size(); }
+	bool empty() const noexcept { return items_.empty(); }
+
+	iterator begin() const noexcept { return items_.begin(); }
+	iterator end() const noexcept { return items_.end(); }
+
+private:
+	static const K& key_of(const K &key) { return key; }
+
+	template <typename Key>
+	size_t position(const Key &key) const {
+		return flat_detail::lower_bound(items_.data(), items_.size(), key, key_of, less_) - items_.data();
+	}
+
+	void sort_unique() { flat_detail::sort_unique(items_, key_of, less_); }
+
+	std::vector<K> items_;
+	Compare less_;
+};
+
+#endif
@@ -0,0 +1,152 @@
+// C++ FlatMap Benchmark
+//
+// FlatMap (flat_map.hpp) vs std::map from c06_maps.cpp, at 1K .. 10M keys, first with
+// string keys (map<string, int>) and then int keys (map<int, int>):
+//   build:   map inserts one pair at a time; FlatMap bulk-builds from the same
+//            unsorted pairs (one sort)
+//   find:    1M lookups, 90% hits: map.find vs FlatMap.find vs the same sorted
+//            array searched with std::lower_bound (int keys: FlatMap is branchless)
+//   loop:    sum every value in key order
+// plus FlatSet vs set (c07_sets.cpp) with count().
+// All times are ns per operation.
+//
+// g++ -std=c++17 -O2 -o main datastructures/flat_map_bench.cpp && ./main [max_keys]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "flat_map.hpp"
+
+using namespace std;
+
+#define LOOKUPS 1000000
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned seed = 1;
+static unsigned next_random() {
+	seed = seed * 1103515245u + 12345u;
+	return seed >> 1;
+}
+
+// Key number i, and one that is never a key
+static void make_key(string &key, size_t i) { key = "person-" + to_string(next_random() % 100000) + "-" + to_string(i); }
+static void make_missing(string &key, size_t q) { key = "nobody-" + to_string(q); }
+static void make_key(int &key, size_t) { key = (int)(next_random() % 1000000000) * 2; }
+static void make_missing(int &key, size_t q) { key = (int)(q * 2 + 1); }
+
+static bool agree = true;
+
+template <typename K>
+static void bench_size(size_t count) {
+	vector<pair<K, int>> people(count);
+	for (size_t i = 0; i < count; i++) {
+		make_key(people[i].first, i);
+		people[i].second = (int)(next_random() % 90);
+	}
+	vector<K> queries(LOOKUPS);
+	for (size_t q = 0; q < LOOKUPS; q++) {
+		if (next_random() % 10 == 0) make_missing(queries[q], q);
+		else queries[q] = people[next_random() % count].first;
+	}
+
+	// ===== BUILD =====
+	double start = now_sec();
+	map<K, int> tree;
+	for (const auto &p : people) tree.insert(p);
+	double map_build = now_sec() - start;
+
+	start = now_sec();
+	FlatMap<K, int> flat(people.begin(), people.end());
+	double flat_build = now_sec() - start;
+
+	// ===== FIND =====
+	long long map_sum = 0, flat_sum = 0, bound_sum = 0;
+	start = now_sec();
+	for (const K &q : queries) {
+		auto it = tree.find(q);
+		if (it != tree.end()) map_sum += it->second;
+	}
+	double map_find = now_sec() - start;
+
+	start = now_sec();
+	for (const K &q : queries) {
+		auto it = flat.find(q);
+		if (it != flat.end()) flat_sum += it->second;
+	}
+	double flat_find = now_sec() - start;
+
+	start = now_sec();
+	for (const K &q : queries) {
+		auto it = lower_bound(flat.begin(), flat.end(), q,
+		                      [](const pair<K, int> &p, const K &key) { return p.first < key; });
+		if (it != flat.end() && it->first == q) bound_sum += it->second;
+	}
+	double bound_find = now_sec() - start;
+
+	// ===== LOOP =====
+	long long map_total = 0, flat_total = 0;
+	start = now_sec();
+	for (const auto &p : tree) map_total += p.second;
+	double map_loop = now_sec() - start;
+	start = now_sec();
+	for (const auto &p : flat) flat_total += p.second;
+	double flat_loop = now_sec() - start;
+
+	agree &= flat.size() == tree.size() && map_sum == flat_sum && map_sum == bound_sum && map_total == flat_total;
+	tree.clear();
+	flat.clear();
+
+	// ===== SET =====
+	vector<K> names;
+	names.reserve(count);
+	for (auto &p : people) names.push_back(move(p.first));
+	people = {};
+	set<K> tree_set(names.begin(), names.end());
+	FlatSet<K> flat_set(move(names));
+	size_t set_found = 0, flat_found = 0;
+	start = now_sec();
+	for (const K &q : queries) set_found += tree_set.count(q);
+	double set_count = now_sec() - start;
+	start = now_sec();
+	for (const K &q : queries) flat_found += flat_set.count(q);
+	double flat_count = now_sec() - start;
+	agree &= set_found == flat_found && tree_set.size() == flat_set.size();
+
+	printf("%9zu | %8.1f %8.1f | %8.1f %8.1f %11.1f | %6.1f %6.1f | %8.1f %8.1f\n", count,
+	       map_build / count * 1e9, flat_build / count * 1e9,
+	       map_find / LOOKUPS * 1e9, flat_find / LOOKUPS * 1e9, bound_find / LOOKUPS * 1e9,
+	       map_loop / count * 1e9, flat_loop / count * 1e9,
+	       set_count / LOOKUPS * 1e9, flat_count / LOOKUPS * 1e9);
+	fflush(stdout);
+}
+
+static void print_header(const char *title) {
+	printf("%s\n", title);
+	printf("%9s | %8s %8s | %8s %8s %11s | %6s %6s | %8s %8s\n", "keys", "map", "FlatMap", "map",
+	       "FlatMap", "lower_bound", "map", "Flat", "set", "FlatSet");
+	printf("%9s | %17s | %30s | %13s | %17s\n", "", "build", "find", "loop", "count");
+}
+
+int main(int argc, char *argv[]) {
+	size_t max_keys = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+	if (max_keys < 1000) max_keys = 1000;
+
+	printf("%zu lookups per size (90%% found), ns per operation\n\n", (size_t)LOOKUPS);
+	print_header("string keys");
+	for (size_t count = 1000; count <= max_keys; count *= 10) bench_size<string>(count);
+	printf("\n");
+	print_header("int keys");
+	for (size_t count = 1000; count <= max_keys; count *= 10) bench_size<int>(count);
+
+	printf("\n%s\n", agree ? "all versions agree" : "MISMATCH between versions!");
+	return 0;
+}
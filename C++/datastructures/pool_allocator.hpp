@@ -0,0 +1,304 @@
+// C++ PoolAllocator Summary
+//
+// A fixed-size-block allocator for node-based containers: list (c02_lists.cpp),
+// set (c07_sets.cpp), map (c06_maps.cpp). Each of these calls the global
+// allocator (new/delete -> malloc/free) once for EVERY element it adds or removes.
+// PoolAllocator is a drop-in replacement for the allocator template argument:
+//
+//   list<string, PoolAllocator<string>> cars;
+//   set<string, less<string>, PoolAllocator<string>> fruits;
+//   map<string, int, less<string>, PoolAllocator<pair<const string, int>>> people;
+//
+// How it works:
+//   - The container asks for one node at a time, always the same size. Nodes
+//     come from 64 KB chunks cut into blocks of exactly that size
+//   - A freed block goes on a FREE LIST (a linked list threaded through the free
+//     blocks themselves); the next allocation pops it: a few instructions, no locks
+//   - Each thread has its own pools and free lists (thread_local), so threads
+//     never contend on the common path. Every chunk knows which pool owns it: a
+//     block freed by ANOTHER thread goes back to the owner's "remote free" list
+//     (under a lock shared by all pools of that block size), and the owner takes
+//     the whole remote list in one go when its own list runs dry
+//   - Types of the same block size share a pool; anything that isn't a single
+//     node (vector-style arrays, oversized or over-aligned types) goes to plain
+//     operator new (the aligned one for alignas(64)-style types)
+//   - When a thread exits, its chunks and free blocks are handed over to the
+//     next thread that needs a pool of that size (never freed under live nodes),
+//     which becomes their owner
+//
+// BULK RELEASE: pool_release() frees all of this thread's chunks in one go,
+// instead of leaving them cached (pool_reserved_bytes() says how much that is).
+// Only call it when no container still holds nodes from those chunks (on any
+// thread), like arena_reset in C/arena.h. Since freed blocks always go back to
+// the pool that owns their chunk, no other thread's free list points into them.
+//
+// Pools are thread_local: don't use PoolAllocator in containers that are global
+// or static (they are destroyed after the main thread's pools).
+//
+// Needs C++17:
+//   g++ -std=c++17 -O2 -pthread -o main datastructures/pool_allocator_bench.cpp && ./main
+
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace pool_detail {
+	constexpr size_t CHUNK_SIZE = 64 * 1024;   // Same as ARENA_DEFAULT_CHUNK in C/arena.h
+	constexpr size_t MAX_BLOCK = 1024;         // Bigger blocks aren't pooled
+
+	struct FreeBlock {
+		FreeBlock *next;
+	};
+
+	class PoolBase;
+
+	// Chunks are CHUNK_SIZE-aligned, so any block finds its chunk header by masking
+	struct Chunk {
+		Chunk *next;
+		std::atomic<PoolBase*> owner;   // nullptr while orphaned
+	};
+
+	inline Chunk* chunk_of(void *block) noexcept {
+		return reinterpret_cast<Chunk*>(reinterpret_cast<uintptr_t>(block) & ~uintptr_t(CHUNK_SIZE - 1));
+	}
+
+	// One per block size: chunks and free blocks left behind by exited threads. The
+	// lock also covers chunk owners changing and pushes onto remote free lists
+	struct Orphans {
+		std::mutex lock;
+		Chunk *chunks = nullptr;
+		FreeBlock *free = nullptr;
+		size_t reserved = 0;
+	};
+
+	// What every block pool of a thread has, whatever its block size. All pools of a
+	// thread are linked together so pool_release() can reach them
+	class PoolBase {
+	public:
+		// Bulk release: every chunk back to the system at once
+		void release() noexcept {
+			while (chunks_ != nullptr) {
+				Chunk *next = chunks_->next;
+				::operator delete(chunks_, std::align_val_t(CHUNK_SIZE));
+				chunks_ = next;
+			}
+			free_ = nullptr;
+			remote_.store(nullptr, std::memory_order_relaxed);
+			cursor_ = end_ = nullptr;
+			reserved_ = 0;
+		}
+
+		size_t reserved() const noexcept { return reserved_; }
+
+		static PoolBase*& first() {
+			thread_local PoolBase *pools = nullptr;
+			return pools;
+		}
+		PoolBase* next() const noexcept { return next_; }
+
+		PoolBase(const PoolBase&) = delete;
+		PoolBase& operator=(const PoolBase&) = delete;
+
+	protected:
+		PoolBase() noexcept : next_(first()) { first() = this; }
+		~PoolBase() {
+			PoolBase **link = &first();
+			while (*link != this) link = &(*link)->next_;
+			*link = next_;
+		}
+
+		FreeBlock *free_ = nullptr;
+		std::atomic<FreeBlock*> remote_{nullptr};   // Blocks freed by other threads
+		char *cursor_ = nullptr;   // Bump through the newest chunk
+		char *end_ = nullptr;
+		Chunk *chunks_ = nullptr;
+		size_t reserved_ = 0;
+
+	private:
+		PoolBase *next_;
+	};
+
+	// Blocks of Size bytes (a multiple of Align) for ONE thread
+	template <size_t Size, size_t Align>
+	class BlockPool : public PoolBase {
+		static_assert(Size >= sizeof(FreeBlock) && Size % Align == 0, "bad block size");
+		static constexpr size_t HEADER = (sizeof(Chunk) + Align - 1) / Align * Align;
+
+	public:
+		static BlockPool& local() {
+			thread_local BlockPool pool;
+			return pool;
+		}
+
+		void* allocate() {
+			if (free_ == nullptr && cursor_ == end_) refill();
+			if (free_ != nullptr) {
+				FreeBlock *block = free_;
+				free_ = block->next;
+				return block;
+			}
+			void *block = cursor_;
+			cursor_ += Size;
+			return block;
+		}
+
+		void deallocate(void *p) noexcept {
+			FreeBlock *block = static_cast<FreeBlock*>(p);
+			Chunk *chunk = chunk_of(p);
+			// Only this thread makes a chunk stop being ours, so a stale "not ours" is
+			// the worst a relaxed read can give: the slow path checks again under the lock
+			if (chunk->owner.load(std::memory_order_relaxed) != this) return remote_free(chunk, block);
+			block->next = free_;
+			free_ = block;
+		}
+
+		// Thread exit: other threads may still use our blocks, so keep the chunks alive
+		~BlockPool() {
+			if (chunks_ == nullptr) return;
+			while (cursor_ != end_) {   // Unused tail of the current chunk -> free blocks
+				FreeBlock *block = reinterpret_cast<FreeBlock*>(cursor_);
+				block->next = free_;
+				free_ = block;
+				cursor_ += Size;
+			}
+			Orphans &o = orphans();
+			std::lock_guard<std::mutex> guard(o.lock);
+			splice(free_, remote_.exchange(nullptr, std::memory_order_acquire));
+			for (Chunk *c = chunks_; c != nullptr; c = c->next) c->owner.store(nullptr, std::memory_order_relaxed);
+			splice(o.chunks, chunks_);
+			splice(o.free, free_);
+			o.reserved += reserved_;
+		}
+
+	private:
+		BlockPool() = default;
+
+		// Leaked on purpose: must outlive every thread_local pool, including main's
+		static Orphans& orphans() {
+			static Orphans *o = new Orphans;
+			return *o;
+		}
+
+		// Append list `from` to list `to`
+		template <typename Node>
+		static void splice(Node *&to, Node *from) {
+			if (from == nullptr) return;
+			Node *tail = from;
+			while (tail->next != nullptr) tail = tail->next;
+			tail->next = to;
+			to = from;
+		}
+
+		// A block of a chunk that isn't ours: back to its owner, or to the orphans
+		static void remote_free(Chunk *chunk, FreeBlock *block) noexcept {
+			Orphans &o = orphans();
+			std::lock_guard<std::mutex> guard(o.lock);
+			PoolBase *owner = chunk->owner.load(std::memory_order_relaxed);
+			if (owner == nullptr) {
+				block->next = o.free;
+				o.free = block;
+				return;
+			}
+			// The owner takes the list without the lock, so push with a CAS
+			std::atomic<FreeBlock*> &remote = static_cast<BlockPool*>(owner)->remote_;
+			block->next = remote.load(std::memory_order_relaxed);
+			while (!remote.compare_exchange_weak(block->next, block, std::memory_order_release,
+			                                     std::memory_order_relaxed)) {
+			}
+		}
+
+		void refill() {
+			free_ = remote_.exchange(nullptr, std::memory_order_acquire);
+			if (free_ != nullptr) return;
+			Orphans &o = orphans();
+			{
+				std::lock_guard<std::mutex> guard(o.lock);
+				if (o.chunks != nullptr) {
+					for (Chunk *c = o.chunks; c != nullptr; c = c->next) c->owner.store(this, std::memory_order_relaxed);
+					splice(chunks_, o.chunks);
+					free_ = o.free;
+					reserved_ += o.reserved;
+					o.chunks = nullptr;
+					o.free = nullptr;
+					o.reserved = 0;
+					if (free_ != nullptr) return;
+				}
+			}
+			Chunk *chunk = static_cast<Chunk*>(::operator new(CHUNK_SIZE, std::align_val_t(CHUNK_SIZE)));
+			chunk->next = chunks_;
+			chunk->owner.store(this, std::memory_order_relaxed);
+			chunks_ = chunk;
+			reserved_ += CHUNK_SIZE;
+			cursor_ = reinterpret_cast<char*>(chunk) + HEADER;
+			end_ = cursor_ + (CHUNK_SIZE - HEADER) / Size * Size;
+		}
+	};
+}
+
+// Bulk release of ALL of this thread's pools (see the top of the file)
+inline void pool_release() noexcept {
+	for (pool_detail::PoolBase *p = pool_detail::PoolBase::first(); p != nullptr; p = p->next()) p->release();
+}
+
+// Bytes this thread's pools hold from the system
+inline size_t pool_reserved_bytes() noexcept {
+	size_t total = 0;
+	for (pool_detail::PoolBase *p = pool_detail::PoolBase::first(); p != nullptr; p = p->next()) total += p->reserved();
+	return total;
+}
+
+template <typename T>
+struct PoolAllocator {
+	using value_type = T;
+	using is_always_equal = std::true_type;   // Stateless: any instance frees any block
+
+	PoolAllocator() noexcept = default;
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n) {
+		if constexpr (pooled) {
+			if (n == 1) return static_cast<T*>(Pool::local().allocate());
+		}
+		if (n > size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+		if constexpr (over_aligned) {
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+		} else {
+			return static_cast<T*>(::operator new(n * sizeof(T)));
+		}
+	}
+
+	void deallocate(T *p, size_t n) noexcept {
+		if constexpr (pooled) {
+			if (n == 1) return Pool::local().deallocate(p);
+		}
+		if constexpr (over_aligned) {
+			::operator delete(p, std::align_val_t(alignof(T)));
+		} else {
+			::operator delete(p);
+		}
+	}
+
+	friend bool operator==(const PoolAllocator&, const PoolAllocator&) noexcept { return true; }
+	friend bool operator!=(const PoolAllocator&, const PoolAllocator&) noexcept { return false; }
+
+private:
+	static constexpr size_t ALIGN = alignof(T) > alignof(pool_detail::FreeBlock) ? alignof(T)
+	                                                                           : alignof(pool_detail::FreeBlock);
+	static constexpr size_t SIZE = ((sizeof(T) > sizeof(pool_detail::FreeBlock) ? sizeof(T)
+	                                                                            : sizeof(pool_detail::FreeBlock))
+	                                + ALIGN - 1) / ALIGN * ALIGN;
+	static constexpr bool pooled = SIZE <= pool_detail::MAX_BLOCK && ALIGN <= alignof(std::max_align_t);
+	// Plain operator new only guarantees this much alignment (like std::allocator)
+	static constexpr bool over_aligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+	using Pool = pool_detail::BlockPool<SIZE, ALIGN>;
+};
+
+#endif
@@ -0,0 +1,141 @@
+// C++ PoolAllocator Benchmark
+//
+// Insert/erase churn on the node containers of the datastructures notes, with the
+// default allocator vs PoolAllocator (pool_allocator.hpp):
+//   list<string>       c02_lists.cpp: push_back a new car, pop_front the oldest
+//   set<string>        c07_sets.cpp:  insert a new name, erase the oldest one
+//   map<string, int>   c06_maps.cpp:  people[new name] = age, erase the oldest
+// Each container holds 100K elements while N new ones go in and N old ones come
+// out, then it is destroyed. Names are short (no string allocation of their own),
+// so the allocator calls are the container nodes. Every version runs on 1 thread
+// and on 4 threads, each with its own container.
+// ns per churn step (one insert + one erase); "destroy" is per element.
+//
+// g++ -std=c++17 -O2 -pthread -o main datastructures/pool_allocator_bench.cpp && ./main [steps]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pool_allocator.hpp"
+
+using namespace std;
+
+#define LIVE 100000
+#define THREADS 4
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename T>
+using Pool = PoolAllocator<T>;
+
+// ===== ONE CHURN STEP PER CONTAINER =====
+
+template <typename A>
+static void add(list<string, A> &c, const string &name) { c.push_back(name); }
+template <typename A>
+static void drop(list<string, A> &c, const string &) { c.pop_front(); }
+
+template <typename A>
+static void add(set<string, less<string>, A> &c, const string &name) { c.insert(name); }
+template <typename A>
+static void drop(set<string, less<string>, A> &c, const string &name) { c.erase(name); }
+
+template <typename A>
+static void add(map<string, int, less<string>, A> &c, const string &name) { c[name] = (int)name.size(); }
+template <typename A>
+static void drop(map<string, int, less<string>, A> &c, const string &name) { c.erase(name); }
+
+static size_t length(const string &s) { return s.size(); }
+static size_t length(const pair<const string, int> &p) { return p.first.size() + p.second; }
+
+struct Result {
+	double churn_sec = 0, destroy_sec = 0;
+	size_t check = 0;
+};
+
+// Fill to LIVE, churn `steps` times, destroy
+template <typename Container>
+static Result churn(const vector<string> &names, size_t steps) {
+	Result r;
+	auto *c = new Container;
+	for (size_t i = 0; i < LIVE; i++) add(*c, names[i]);
+	double start = now_sec();
+	for (size_t i = LIVE; i < LIVE + steps; i++) {
+		add(*c, names[i]);
+		drop(*c, names[i - LIVE]);
+	}
+	r.churn_sec = now_sec() - start;
+	for (const auto &item : *c) r.check += length(item);
+	start = now_sec();
+	delete c;
+	r.destroy_sec = now_sec() - start;
+	return r;
+}
+
+// The same on THREADS threads at once, each with its own container
+template <typename Container>
+static Result churn_threads(const vector<string> &names, size_t steps) {
+	vector<Result> results(THREADS);
+	vector<thread> pool;
+	double start = now_sec();
+	for (int t = 0; t < THREADS; t++) {
+		pool.emplace_back([&, t] { results[t] = churn<Container>(names, steps / THREADS); });
+	}
+	for (thread &t : pool) t.join();
+	Result r;
+	r.churn_sec = now_sec() - start;   // Wall time of the whole run
+	for (const Result &part : results) r.check += part.check;
+	return r;
+}
+
+static bool agree = true;
+
+template <typename Plain, typename Pooled>
+static void compare(const char *name, const vector<string> &names, size_t steps) {
+	Result plain = churn<Plain>(names, steps);
+	Result pooled = churn<Pooled>(names, steps);
+	Result plain_mt = churn_threads<Plain>(names, steps);
+	Result pooled_mt = churn_threads<Pooled>(names, steps);
+	agree &= plain.check == pooled.check && plain_mt.check == pooled_mt.check;
+	printf("%-18s | %8.1f %8.1f | %8.1f %8.1f | %9.1f %9.1f\n", name,
+	       plain.churn_sec / steps * 1e9, pooled.churn_sec / steps * 1e9,
+	       plain.destroy_sec / LIVE * 1e9, pooled.destroy_sec / LIVE * 1e9,
+	       plain_mt.churn_sec / steps * 1e9, pooled_mt.churn_sec / steps * 1e9);
+	fflush(stdout);
+}
+
+int main(int argc, char *argv[]) {
+	size_t steps = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000000;
+	if (steps < THREADS) steps = THREADS;
+
+	// Short names (fit in std::string itself), in no particular order
+	vector<string> names(LIVE + steps);
+	for (size_t i = 0; i < names.size(); i++) names[i] = "car" + to_string(i * 2654435761u % 1000000000);
+
+	printf("%zu churn steps, %d live elements, %u CPU core(s), ns per step\n\n", steps, LIVE,
+	       thread::hardware_concurrency());
+	printf("%-18s | %8s %8s | %8s %8s | %9s %9s\n", "", "new", "pool", "new", "pool", "new", "pool");
+	printf("%-18s | %17s | %17s | %19s\n", "", "churn", "destroy", "churn, 4 threads");
+
+	compare<list<string>, list<string, Pool<string>>>("list<string>", names, steps);
+	compare<set<string>, set<string, less<string>, Pool<string>>>("set<string>", names, steps);
+	compare<map<string, int>, map<string, int, less<string>, Pool<pair<const string, int>>>>(
+		"map<string, int>", names, steps);
+
+	// Everything is destroyed: hand this thread's cached chunks back
+	size_t cached = pool_reserved_bytes();
+	pool_release();
+	printf("\npool_release(): %.1f MB of cached chunks freed, %zu bytes left\n", cached / 1e6, pool_reserved_bytes());
+
+	printf("\n%s\n", agree ? "all versions agree" : "MISMATCH between versions!");
+	return 0;
+}
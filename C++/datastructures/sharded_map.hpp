@@ -0,0 +1,201 @@
+// C++ ShardedMap / ShardedSet Summary
+//
+// Thread-safe versions of the maps and sets in c06_maps.cpp / c07_sets.cpp.
+//
+// The usual fix for sharing a map between threads is ONE mutex around it:
+// every thread, reader or writer, waits for every other one. ShardedMap splits
+// the keys over `Shards` independent SwissMaps (swiss_map.hpp), picked by hash,
+// each with its own reader-writer lock (std::shared_mutex):
+//   - threads working on different shards never wait for each other
+//   - readers of the same shard share its lock; only writers take it alone
+//   - each shard sits on its own cache line(s), so two threads locking
+//     neighbouring shards don't fight over one line (false sharing)
+// The key is hashed once: the same hash picks the shard and the slot inside it.
+//
+//   ShardedMap<string, int> ages;
+//   ages.insert_or_assign("John", 32);
+//   optional<int> age = ages.find("John");               // a COPY: no reference escapes the lock
+//   ages.update("John", [](int &a) { a++; });            // read-modify-write under one lock
+//   ages.erase("John");
+//
+// Every call is atomic on its own; a find followed by an insert is not. Use
+// update() for read-modify-write. size() and for_each() visit the shards one
+// after another: not a snapshot while other threads are writing.
+//
+// Readers still write to the shard's lock word, so heavy read-only traffic on
+// ONE hot key does not scale; spread keys over shards (that's what hashing does).
+//
+// Needs C++17 (std::shared_mutex, std::optional):
+//   g++ -std=c++17 -O2 -pthread -o main datastructures/sharded_map_bench.cpp && ./main
+
+#ifndef SHARDED_MAP_HPP
+#define SHARDED_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "swiss_map.hpp"
+
+template <typename K, typename V, size_t Shards = 64, typename Hash = SwissHash<K>, typename Eq = std::equal_to<>>
+class ShardedMap {
+	static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "Shards must be a power of 2");
+
+	using Map = SwissMap<K, V, Hash, Eq>;
+
+	struct alignas(64) Shard {
+		mutable std::shared_mutex lock;
+		Map map;
+	};
+
+public:
+	ShardedMap() = default;
+	ShardedMap(const ShardedMap&) = delete;
+	ShardedMap& operator=(const ShardedMap&) = delete;
+
+	// ===== READ (shared lock) =====
+
+	// Copy of the value, or nullopt
+	template <typename Key>
+	std::optional<V> find(const Key &key) const {
+		uint64_t h = hash_(key);
+		const Shard &s = shard(h);
+		std::shared_lock<std::shared_mutex> guard(s.lock);
+		auto it = s.map.find(key, h);
+		if (it == s.map.end()) return std::nullopt;
+		return it->second;
+	}
+
+	template <typename Key>
+	bool contains(const Key &key) const {
+		uint64_t h = hash_(key);
+		const Shard &s = shard(h);
+		std::shared_lock<std::shared_mutex> guard(s.lock);
+		return s.map.find(key, h) != s.map.end();
+	}
+
+	// ===== WRITE (exclusive lock) =====
+
+	// true if the key was new
+	template <typename Key, typename Value>
+	bool insert(Key &&key, Value &&value) {
+		uint64_t h = hash_(key);
+		Shard &s = shard(h);
+		std::unique_lock<std::shared_mutex> guard(s.lock);
+		return s.map.try_emplace_hashed(h, std::forward<Key>(key), std::forward<Value>(value)).second;
+	}
+
+	// true if the key was new, false if an old value was replaced
+	template <typename Key, typename Value>
+	bool insert_or_assign(Key &&key, Value &&value) {
+		uint64_t h = hash_(key);
+		Shard &s = shard(h);
+		std::unique_lock<std::shared_mutex> guard(s.lock);
+		auto [it, inserted] = s.map.try_emplace_hashed(h, std::forward<Key>(key), std::forward<Value>(value));
+		if (!inserted) it->second = std::forward<Value>(value);
+		return inserted;
+	}
+
+	// Number of elements removed (0 or 1)
+	template <typename Key>
+	size_t erase(const Key &key) {
+		uint64_t h = hash_(key);
+		Shard &s = shard(h);
+		std::unique_lock<std::shared_mutex> guard(s.lock);
+		return s.map.erase(key, h);
+	}
+
+	// Atomic read-modify-write: fn(V&) runs under the shard's write lock, on the
+	// existing value or on a new V() if the key was missing. Returns what fn returns.
+	// Keep fn short and don't touch the map from inside it (deadlock).
+	template <typename Key, typename Fn>
+	decltype(auto) update(Key &&key, Fn &&fn) {
+		uint64_t h = hash_(key);
+		Shard &s = shard(h);
+		std::unique_lock<std::shared_mutex> guard(s.lock);
+		return fn(s.map.try_emplace_hashed(h, std::forward<Key>(key)).first->second);
+	}
+
+	// ===== WHOLE MAP (shard by shard) =====
+
+	size_t size() const {
+		size_t total = 0;
+		for (const Shard &s : shards_) {
+			std::shared_lock<std::shared_mutex> guard(s.lock);
+			total += s.map.size();
+		}
+		return total;
+	}
+
+	bool empty() const { return size() == 0; }
+
+	void clear() {
+		for (Shard &s : shards_) {
+			std::unique_lock<std::shared_mutex> guard(s.lock);
+			s.map.clear();
+		}
+	}
+
+	// fn(const K&, const V&) for every element, each shard under its read lock
+	template <typename Fn>
+	void for_each(Fn &&fn) const {
+		for (const Shard &s : shards_) {
+			std::shared_lock<std::shared_mutex> guard(s.lock);
+			for (const auto &item : s.map) fn(item.first, item.second);
+		}
+	}
+
+	// Room for count keys in total (spread evenly) without growing
+	void reserve(size_t count) {
+		for (Shard &s : shards_) {
+			std::unique_lock<std::shared_mutex> guard(s.lock);
+			s.map.reserve(count / Shards + 1);
+		}
+	}
+
+private:
+	// Bits 32..: the low 32 pick the slot inside the shard, the top 7 the control byte
+	Shard& shard(uint64_t h) { return shards_[(h >> 32) & (Shards - 1)]; }
+	const Shard& shard(uint64_t h) const { return shards_[(h >> 32) & (Shards - 1)]; }
+
+	Shard shards_[Shards];
+	Hash hash_;
+};
+
+// ===== SET =====
+
+template <typename K, size_t Shards = 64, typename Hash = SwissHash<K>, typename Eq = std::equal_to<>>
+class ShardedSet {
+	struct Empty {};
+
+public:
+	// true if the key was new
+	template <typename Key>
+	bool insert(Key &&key) { return map_.insert(std::forward<Key>(key), Empty()); }
+
+	template <typename Key>
+	bool contains(const Key &key) const { return map_.contains(key); }
+	template <typename Key>
+	size_t count(const Key &key) const { return map_.contains(key); }
+
+	template <typename Key>
+	size_t erase(const Key &key) { return map_.erase(key); }
+
+	size_t size() const { return map_.size(); }
+	bool empty() const { return map_.empty(); }
+	void clear() { map_.clear(); }
+	void reserve(size_t count) { map_.reserve(count); }
+
+	template <typename Fn>
+	void for_each(Fn &&fn) const {
+		map_.for_each([&](const K &key, const Empty&) { fn(key); });
+	}
+
+private:
+	ShardedMap<K, Empty, Shards, Hash, Eq> map_;
+};
+
+#endif
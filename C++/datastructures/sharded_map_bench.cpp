@@ -0,0 +1,179 @@
+// C++ ShardedMap Benchmark
+//
+// A name -> count map shared by 1, 2, 4 ... 64 threads, two ways:
+//   mutex map    map<string, int, less<>> behind ONE std::mutex (the usual fix)
+//   ShardedMap   sharded_map.hpp: 64 SwissMaps, each with its own shared_mutex
+// The map starts with 100K names; operations pick from twice as many names.
+// A read is a find; a write is update(name, count++) or erase(name), half each.
+// Read/write mixes: 99/1, 90/10, 50/50. The same total number of operations is
+// split over the threads, so flat = no scaling, rising = scaling. At 1 thread
+// the gap is the hash map vs the tree; the rest is the locking.
+// Threads only run in parallel up to the number of CPU cores.
+// Afterwards 8 threads each update() the same 1000 names: no increment may be lost.
+//
+// g++ -std=c++17 -O2 -pthread -o main datastructures/sharded_map_bench.cpp && ./main [operations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "sharded_map.hpp"
+
+using namespace std;
+
+#define KEYS 100000
+#define MAX_THREADS 64
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ===== THE ONE-MUTEX VERSION =====
+
+class MutexMap {
+public:
+	bool find(string_view key, int *out) const {
+		lock_guard<mutex> guard(lock_);
+		auto it = map_.find(key);
+		if (it == map_.end()) return false;
+		*out = it->second;
+		return true;
+	}
+	int increment(string_view key) {
+		lock_guard<mutex> guard(lock_);
+		auto it = map_.find(key);
+		if (it == map_.end()) it = map_.emplace(key, 0).first;
+		return ++it->second;
+	}
+	size_t erase(string_view key) {
+		lock_guard<mutex> guard(lock_);
+		auto it = map_.find(key);
+		if (it == map_.end()) return 0;
+		map_.erase(it);
+		return 1;
+	}
+	long long total() const {
+		lock_guard<mutex> guard(lock_);
+		long long sum = 0;
+		for (const auto &item : map_) sum += item.second;
+		return sum;
+	}
+
+private:
+	mutable mutex lock_;
+	map<string, int, less<>> map_;
+};
+
+// ===== SAME CALLS ON BOTH =====
+
+static bool find(const MutexMap &m, string_view key, int *out) { return m.find(key, out); }
+static bool find(const ShardedMap<string, int> &m, string_view key, int *out) {
+	optional<int> value = m.find(key);
+	if (value) *out = *value;
+	return value.has_value();
+}
+
+static int increment(MutexMap &m, string_view key) { return m.increment(key); }
+static int increment(ShardedMap<string, int> &m, string_view key) {
+	return m.update(key, [](int &count) { return ++count; });
+}
+
+static size_t erase(MutexMap &m, string_view key) { return m.erase(key); }
+static size_t erase(ShardedMap<string, int> &m, string_view key) { return m.erase(key); }
+
+static long long total(const MutexMap &m) { return m.total(); }
+static long long total(const ShardedMap<string, int> &m) {
+	long long sum = 0;
+	m.for_each([&](const string&, int count) { sum += count; });
+	return sum;
+}
+
+// ===== WORKLOAD =====
+
+template <typename Map>
+static void worker(Map *m, const vector<string> *names, size_t ops, unsigned read_percent, unsigned seed,
+                   long long *found) {
+	long long sum = 0;
+	for (size_t i = 0; i < ops; i++) {
+		seed = seed * 1103515245u + 12345u;
+		unsigned r = seed >> 1;
+		string_view key = (*names)[(r >> 8) % names->size()];
+		int value;
+		if (r % 100 < read_percent) {
+			if (find(*m, key, &value)) sum += value;
+		} else if ((r >> 7) & 1) {
+			increment(*m, key);
+		} else {
+			erase(*m, key);
+		}
+	}
+	*found = sum;
+}
+
+// Millions of operations per second
+template <typename Map>
+static double run(const vector<string> &names, int threads, size_t ops, unsigned read_percent) {
+	Map m;
+	for (size_t i = 0; i < KEYS; i++) increment(m, names[i]);
+
+	vector<thread> pool;
+	vector<long long> found(threads);
+	double start = now_sec();
+	for (int t = 0; t < threads; t++) {
+		size_t share = ops / threads + (t < (int)(ops % threads));
+		pool.emplace_back(worker<Map>, &m, &names, share, read_percent, 1u + t * 7919u, &found[t]);
+	}
+	for (thread &t : pool) t.join();
+	return ops / (now_sec() - start) / 1e6;
+}
+
+// Every thread increments every name `rounds` times: the counts must add up
+template <typename Map>
+static bool updates_counted(const vector<string> &names, int threads, int rounds) {
+	Map m;
+	vector<thread> pool;
+	for (int t = 0; t < threads; t++) {
+		pool.emplace_back([&m, &names, rounds, t] {
+			for (int r = 0; r < rounds; r++) {
+				for (size_t i = 0; i < 1000; i++) increment(m, names[(i + t * 97) % 1000]);
+			}
+		});
+	}
+	for (thread &t : pool) t.join();
+	return total(m) == (long long)threads * rounds * 1000;
+}
+
+int main(int argc, char *argv[]) {
+	size_t ops = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000000;
+	if (ops < MAX_THREADS) ops = MAX_THREADS;
+
+	vector<string> names(2 * KEYS);
+	for (size_t i = 0; i < names.size(); i++) names[i] = "person-" + to_string(i * 2654435761u % 100000) + "-" + to_string(i);
+
+	printf("%zu operations, %u CPU core(s)\n\n", ops, thread::hardware_concurrency());
+	printf("%8s | %11s %11s | %11s %11s | %11s %11s   (M ops/s)\n", "threads", "mutex map", "ShardedMap",
+	       "mutex map", "ShardedMap", "mutex map", "ShardedMap");
+	printf("%8s | %23s | %23s | %23s\n", "read %", "99", "90", "50");
+	const unsigned read_percents[] = {99, 90, 50};
+
+	for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+		printf("%8d", threads);
+		for (unsigned read_percent : read_percents) {
+			printf(" | %11.2f", run<MutexMap>(names, threads, ops, read_percent));
+			printf(" %11.2f", run<ShardedMap<string, int>>(names, threads, ops, read_percent));
+			fflush(stdout);
+		}
+		printf("\n");
+	}
+
+	bool ok = updates_counted<MutexMap>(names, 8, 100) && updates_counted<ShardedMap<string, int>>(names, 8, 100);
+	printf("\n%s\n", ok ? "every update counted" : "MISMATCH: updates lost!");
+	return 0;
+}
@@ -0,0 +1,480 @@
+// C++ SwissMap Summary
+//
+// An unordered hash map in the style of C/hashmap.h (SwissTable layout), as a
+// template with the std::unordered_map surface used for `people` in c06_maps.cpp:
+// [], at, find, count, contains, insert, try_emplace, insert_or_assign, erase,
+// size, empty, clear, for-each loops (in no particular order).
+//
+// std::map compares strings at every level of a tree: O(log n) compares and
+// pointer hops. A hash map turns the key into a slot number: ~1 compare.
+//
+// Layout:
+//   - One CONTROL byte per slot: 0x80 = empty, otherwise 7 bits of the key's hash
+//   - Lookup compares 16 control bytes at once (one SSE2 instruction); only slots
+//     whose 7 bits match get a real key comparison
+//   - Linear probing, backward-shift deletion: no tombstones after many erases
+//   - The low 32 hash bits are stored per slot: growing never rehashes a key
+//
+// Extras:
+//   - HETEROGENEOUS lookup: SwissMap<string, int> finds a string_view or a
+//     const char* without building a temporary std::string
+//   - PRECOMPUTED hashes: uint64_t h = people.hash_of(name); then find(name, h),
+//     try_emplace_hashed(h, name, ...), erase(name, h) skip hashing again
+//   - reserve(n) (room for n keys, no growth), rehash(slots), bucket_count(),
+//     load_factor(); the table grows 2x at 80% full
+//
+// Unlike std::unordered_map, insert/erase may move elements: they invalidate
+// iterators and references. Keys are stored non-const: don't change them in place.
+//
+// Needs C++17:
+//   g++ -std=c++17 -O2 -o main datastructures/swiss_map_bench.cpp && ./main
+
+#ifndef SWISS_MAP_HPP
+#define SWISS_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// ===== HASHING =====
+// The map uses the low bits (home slot) and the top 7 bits (control byte),
+// so the hash must be well mixed - std::hash<int> is the identity on most libraries
+
+namespace swiss_detail {
+	inline uint64_t avalanche(uint64_t x) {
+		x ^= x >> 32;
+		x *= 0xd6e8feb86659fd93ull;
+		x ^= x >> 32;
+		x *= 0xd6e8feb86659fd93ull;
+		x ^= x >> 32;
+		return x;
+	}
+
+	// Same as hash_bytes() in C/hashmap.c: 8 bytes per step, then a final mix
+	inline uint64_t hash_bytes(const void *key, size_t size) {
+		const unsigned char *p = static_cast<const unsigned char*>(key);
+		uint64_t h = 0x9E3779B97F4A7C15ull ^ size;
+		size_t n = size;
+		for (; n >= 8; p += 8, n -= 8) {
+			uint64_t w;
+			std::memcpy(&w, p, 8);
+			h ^= w * 0x87c37b91114253d5ull;
+			h = ((h << 27) | (h >> 37)) * 0x4cf5ad432745937full;
+		}
+		if (n > 0) {
+			uint64_t w = 0;
+			std::memcpy(&w, p, n);
+			h ^= w * 0x87c37b91114253d5ull;
+			h = ((h << 27) | (h >> 37)) * 0x4cf5ad432745937full;
+		}
+		return avalanche(h);
+	}
+}
+
+// Default: std::hash, then mixed
+template <typename K>
+struct SwissHash {
+	uint64_t operator()(const K &key) const { return swiss_detail::avalanche(std::hash<K>()(key)); }
+};
+
+// Strings: is_transparent = string, string_view and const char* all hash the same
+template <>
+struct SwissHash<std::string> {
+	using is_transparent = void;
+	uint64_t operator()(std::string_view key) const { return swiss_detail::hash_bytes(key.data(), key.size()); }
+};
+
+// ===== MAP =====
+
+template <typename K, typename V, typename Hash = SwissHash<K>, typename Eq = std::equal_to<>>
+class SwissMap {
+	static constexpr size_t GROUP = 16;          // Control bytes compared per step
+	static constexpr uint8_t EMPTY = 0x80;       // Full slots hold 0..127
+	static constexpr size_t MIN_CAPACITY = 16;   // At least one group, so the mirrored bytes are well-defined
+	static constexpr size_t NOT_FOUND = size_t(-1);
+
+public:
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<K, V>;
+
+	template <bool Const>
+	class Iterator {
+		using Map = std::conditional_t<Const, const SwissMap, SwissMap>;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = SwissMap::value_type;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::conditional_t<Const, const value_type&, value_type&>;
+		using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+		Iterator() = default;
+		Iterator(Map *map, size_t i) : map_(map), i_(i) { skip_empty(); }
+		operator Iterator<true>() const { return Iterator<true>(map_, i_); }
+
+		reference operator*() const { return map_->slots_[i_]; }
+		pointer operator->() const { return &map_->slots_[i_]; }
+		Iterator& operator++() {
+			i_++;
+			skip_empty();
+			return *this;
+		}
+		Iterator operator++(int) {
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+		bool operator==(const Iterator &other) const { return i_ == other.i_; }
+		bool operator!=(const Iterator &other) const { return i_ != other.i_; }
+
+	private:
+		friend class SwissMap;
+		void skip_empty() {
+			while (i_ < map_->capacity_ && map_->ctrl_[i_] == EMPTY) i_++;
+		}
+		Map *map_ = nullptr;
+		size_t i_ = 0;
+	};
+
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	// ===== CONSTRUCT / DESTROY =====
+
+	SwissMap() = default;
+
+	SwissMap(std::initializer_list<value_type> items) {
+		reserve(items.size());
+		for (const value_type &item : items) insert(item);
+	}
+
+	SwissMap(const SwissMap &other) : hash_(other.hash_), eq_(other.eq_) {
+		if (other.size_ == 0) return;
+		allocate(other.capacity_);
+		// Same capacity, same stored hashes: every entry goes in the same slot
+		try {
+			for (size_t i = 0; i < other.capacity_; i++) {
+				if (other.ctrl_[i] == EMPTY) continue;
+				new (&slots_[i]) value_type(other.slots_[i]);
+				set_ctrl(i, other.ctrl_[i]);
+				hashes_[i] = other.hashes_[i];
+				size_++;
+			}
+		} catch (...) {
+			clear();
+			release(ctrl_, hashes_, slots_, capacity_);
+			throw;
+		}
+	}
+
+	SwissMap(SwissMap &&other) noexcept { swap(other); }
+
+	SwissMap& operator=(SwissMap other) noexcept {
+		swap(other);
+		return *this;
+	}
+
+	~SwissMap() {
+		clear();
+		release(ctrl_, hashes_, slots_, capacity_);
+	}
+
+	void swap(SwissMap &other) noexcept {
+		std::swap(ctrl_, other.ctrl_);
+		std::swap(hashes_, other.hashes_);
+		std::swap(slots_, other.slots_);
+		std::swap(capacity_, other.capacity_);
+		std::swap(size_, other.size_);
+		std::swap(hash_, other.hash_);
+		std::swap(eq_, other.eq_);
+	}
+
+	// ===== ACCESS =====
+
+	// Inserts V() if the key is missing, like std::unordered_map
+	V& operator[](const K &key) { return try_emplace(key).first->second; }
+	V& operator[](K &&key) { return try_emplace(std::move(key)).first->second; }
+
+	template <typename Key>
+	V& at(const Key &key) {
+		size_t i = find_slot(key, hash_of(key));
+		if (i == NOT_FOUND) throw std::out_of_range("SwissMap::at");
+		return slots_[i].second;
+	}
+	template <typename Key>
+	const V& at(const Key &key) const {
+		size_t i = find_slot(key, hash_of(key));
+		if (i == NOT_FOUND) throw std::out_of_range("SwissMap::at");
+		return slots_[i].second;
+	}
+
+	// ===== LOOKUP =====
+
+	template <typename Key>
+	uint64_t hash_of(const Key &key) const { return hash_(key); }
+
+	// `hash` must be hash_of(key)
+	template <typename Key>
+	iterator find(const Key &key, uint64_t hash) { return at_slot(find_slot(key, hash)); }
+	template <typename Key>
+	const_iterator find(const Key &key, uint64_t hash) const { return at_slot(find_slot(key, hash)); }
+
+	template <typename Key>
+	iterator find(const Key &key) { return find(key, hash_of(key)); }
+	template <typename Key>
+	const_iterator find(const Key &key) const { return find(key, hash_of(key)); }
+
+	template <typename Key>
+	size_t count(const Key &key) const { return find_slot(key, hash_of(key)) != NOT_FOUND; }
+	template <typename Key>
+	bool contains(const Key &key) const { return find_slot(key, hash_of(key)) != NOT_FOUND; }
+
+	// ===== INSERT =====
+
+	// Does nothing if the key is already there (returns it with false)
+	std::pair<iterator, bool> insert(const value_type &item) { return try_emplace(item.first, item.second); }
+	std::pair<iterator, bool> insert(value_type &&item) {
+		return try_emplace(std::move(item.first), std::move(item.second));
+	}
+
+	// key may be anything K can be built from (string_view for string keys):
+	// K is only constructed if the key is new
+	template <typename Key, typename... Args>
+	std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+		uint64_t hash = hash_of(key);
+		return try_emplace_hashed(hash, std::forward<Key>(key), std::forward<Args>(args)...);
+	}
+
+	// `hash` must be hash_of(key)
+	template <typename Key, typename... Args>
+	std::pair<iterator, bool> try_emplace_hashed(uint64_t hash, Key &&key, Args &&...args) {
+		size_t i = find_slot(key, hash);
+		if (i != NOT_FOUND) return {at_slot(i), false};
+		if (size_ + 1 > max_load(capacity_)) resize(capacity_ ? capacity_ * 2 : MIN_CAPACITY);
+		i = find_empty(uint32_t(hash) & (capacity_ - 1));
+		new (&slots_[i]) value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<Key>(key)),
+		                            std::forward_as_tuple(std::forward<Args>(args)...));
+		set_ctrl(i, h2(hash));
+		hashes_[i] = uint32_t(hash);
+		size_++;
+		return {at_slot(i), true};
+	}
+
+	template <typename Key, typename Value>
+	std::pair<iterator, bool> insert_or_assign(Key &&key, Value &&value) {
+		auto [it, inserted] = try_emplace(std::forward<Key>(key), std::forward<Value>(value));
+		if (!inserted) it->second = std::forward<Value>(value);
+		return {it, inserted};
+	}
+
+	// ===== ERASE =====
+
+	// Number of elements removed (0 or 1)
+	template <typename Key>
+	size_t erase(const Key &key) { return erase(key, hash_of(key)); }
+
+	template <typename Key>
+	size_t erase(const Key &key, uint64_t hash) {
+		size_t hole = find_slot(key, hash);
+		if (hole == NOT_FOUND) return 0;
+		slots_[hole].~value_type();
+
+		// Backward shift (see hashmap_remove in C/hashmap.c): an entry further along
+		// the run whose home is at or before the hole moves back into it
+		size_t mask = capacity_ - 1;
+		for (size_t j = (hole + 1) & mask; ctrl_[j] != EMPTY; j = (j + 1) & mask) {
+			size_t home = hashes_[j] & mask;
+			if (((j - home) & mask) >= ((j - hole) & mask)) {
+				new (&slots_[hole]) value_type(std::move(slots_[j]));
+				slots_[j].~value_type();
+				set_ctrl(hole, ctrl_[j]);
+				hashes_[hole] = hashes_[j];
+				hole = j;
+			}
+		}
+		set_ctrl(hole, EMPTY);
+		size_--;
+		return 1;
+	}
+
+	// size = 0, keeps the slots
+	void clear() noexcept {
+		if (capacity_ == 0) return;
+		if constexpr (!std::is_trivially_destructible_v<value_type>) {
+			for (size_t i = 0; i < capacity_; i++) {
+				if (ctrl_[i] != EMPTY) slots_[i].~value_type();
+			}
+		}
+		std::memset(ctrl_, EMPTY, capacity_ + GROUP);
+		size_ = 0;
+	}
+
+	// ===== CAPACITY =====
+
+	// Room for count keys without growing
+	void reserve(size_t count) {
+		size_t capacity = capacity_ ? capacity_ : MIN_CAPACITY;
+		while (max_load(capacity) < count) capacity *= 2;
+		if (capacity > capacity_) resize(capacity);
+	}
+
+	// Resize to at least `slots` (rounded up to a power of 2, and enough for size());
+	// rehash(0) shrinks the table to fit
+	void rehash(size_t slots) {
+		size_t capacity = MIN_CAPACITY;
+		while (capacity < slots || max_load(capacity) < size_) capacity *= 2;
+		if (size_ == 0 && slots == 0) {
+			release(ctrl_, hashes_, slots_, capacity_);
+			ctrl_ = nullptr;
+			hashes_ = nullptr;
+			slots_ = nullptr;
+			capacity_ = 0;
+		} else if (capacity != capacity_) {
+			resize(capacity);
+		}
+	}
+
+	size_t bucket_count() const noexcept { return capacity_; }
+	float load_factor() const noexcept { return capacity_ ? float(size_) / capacity_ : 0.0f; }
+	static constexpr float max_load_factor() noexcept { return 0.8f; }
+
+	size_t size() const noexcept { return size_; }
+	bool empty() const noexcept { return size_ == 0; }
+
+	// ===== ITERATE =====
+
+	iterator begin() noexcept { return iterator(this, 0); }
+	iterator end() noexcept { return iterator(this, capacity_); }
+	const_iterator begin() const noexcept { return const_iterator(this, 0); }
+	const_iterator end() const noexcept { return const_iterator(this, capacity_); }
+
+private:
+	// Linear probing slows down sharply near full: grow at 80%
+	static size_t max_load(size_t capacity) { return capacity / 5 * 4; }
+	static uint8_t h2(uint64_t hash) { return uint8_t(hash >> 57); }   // Top 7 bits
+
+	// ===== CONTROL BYTE GROUPS =====
+	// Bit b of a mask = control byte b of the 16-byte group
+
+	static unsigned group_match(const uint8_t *group, uint8_t h) {
+#if defined(__SSE2__)
+		__m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(char(h)))));
+#else
+		unsigned mask = 0;
+		for (unsigned b = 0; b < GROUP; b++) mask |= unsigned(group[b] == h) << b;
+		return mask;
+#endif
+	}
+
+	static unsigned group_empty(const uint8_t *group) {
+#if defined(__SSE2__)
+		// EMPTY is the only control byte with the top bit set - movemask collects top bits
+		return unsigned(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+		return group_match(group, EMPTY);
+#endif
+	}
+
+	void set_ctrl(size_t i, uint8_t value) {
+		ctrl_[i] = value;
+		if (i < GROUP) ctrl_[capacity_ + i] = value;   // Mirror: groups can read past the end
+	}
+
+	iterator at_slot(size_t i) { return i == NOT_FOUND ? end() : iterator(this, i); }
+	const_iterator at_slot(size_t i) const { return i == NOT_FOUND ? end() : const_iterator(this, i); }
+
+	// ===== PROBING =====
+
+	template <typename Key>
+	size_t find_slot(const Key &key, uint64_t hash) const {
+		if (capacity_ == 0) return NOT_FOUND;
+		size_t mask = capacity_ - 1;
+		uint8_t h = h2(hash);
+		for (size_t pos = uint32_t(hash) & mask;; pos = (pos + GROUP) & mask) {
+			const uint8_t *group = ctrl_ + pos;
+			unsigned empty = group_empty(group);
+			unsigned match = group_match(group, h);
+			// The key can only be BEFORE the first empty slot (linear probing)
+			if (empty != 0) match &= (empty & (~empty + 1)) - 1;
+			while (match != 0) {
+				size_t i = (pos + unsigned(__builtin_ctz(match))) & mask;
+				if (hashes_[i] == uint32_t(hash) && eq_(slots_[i].first, key)) return i;
+				match &= match - 1;
+			}
+			if (empty != 0) return NOT_FOUND;
+		}
+	}
+
+	// First empty slot at or after home (there always is one: the map is never full)
+	size_t find_empty(size_t home) const {
+		size_t mask = capacity_ - 1;
+		for (size_t pos = home;; pos = (pos + GROUP) & mask) {
+			unsigned empty = group_empty(ctrl_ + pos);
+			if (empty != 0) return (pos + unsigned(__builtin_ctz(empty))) & mask;
+		}
+	}
+
+	// ===== MEMORY =====
+
+	void allocate(size_t capacity) {
+		if (capacity - 1 > UINT32_MAX) throw std::length_error("SwissMap: home slots come from 32 hash bits");
+		std::unique_ptr<uint8_t[]> ctrl(new uint8_t[capacity + GROUP]);
+		std::unique_ptr<uint32_t[]> hashes(new uint32_t[capacity]);
+		slots_ = std::allocator<value_type>().allocate(capacity);
+		std::memset(ctrl.get(), EMPTY, capacity + GROUP);
+		ctrl_ = ctrl.release();
+		hashes_ = hashes.release();
+		capacity_ = capacity;
+	}
+
+	static void release(uint8_t *ctrl, uint32_t *hashes, value_type *slots, size_t capacity) {
+		delete[] ctrl;
+		delete[] hashes;
+		if (slots) std::allocator<value_type>().deallocate(slots, capacity);
+	}
+
+	// Reinsert using the stored hash bits - the hash function is never called again
+	void resize(size_t capacity) {
+		uint8_t *old_ctrl = ctrl_;
+		uint32_t *old_hashes = hashes_;
+		value_type *old_slots = slots_;
+		size_t old_capacity = capacity_;
+		allocate(capacity);   // Throws with the old table untouched
+		for (size_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] == EMPTY) continue;
+			size_t j = find_empty(old_hashes[i] & (capacity - 1));
+			new (&slots_[j]) value_type(std::move(old_slots[i]));
+			old_slots[i].~value_type();
+			set_ctrl(j, old_ctrl[i]);
+			hashes_[j] = old_hashes[i];
+		}
+		release(old_ctrl, old_hashes, old_slots, old_capacity);
+	}
+
+	uint8_t *ctrl_ = nullptr;       // capacity + GROUP bytes: the last 16 repeat the first 16
+	uint32_t *hashes_ = nullptr;    // Low 32 hash bits per slot
+	value_type *slots_ = nullptr;   // Constructed only where ctrl_ != EMPTY
+	size_t capacity_ = 0;           // Power of 2 (>= 16), or 0 before the first insert
+	size_t size_ = 0;
+	Hash hash_;
+	Eq eq_;
+};
+
+#endif
@@ -0,0 +1,187 @@
+// C++ SwissMap Benchmark
+//
+// The `people` name -> age map from c06_maps.cpp, four ways:
+//   std::map            map<string, int, less<>> (less<> lets find take a string_view)
+//   std::unordered_map  unordered_map<string, int>: in C++17 its find/erase need a
+//                       temporary std::string for every string_view key
+//   SwissMap            swiss_map.hpp, looked up by string_view directly
+//   SwissMap, hashed    the same, with every key's hash computed beforehand
+//                       (find(key, h), try_emplace_hashed(h, ...), erase(key, h))
+// Operations, all keys are string_views into one list of names:
+//   insert  every person once
+//   find    1M lookups, 90% found
+//   erase   half of the people
+//   mixed   1M operations: 50% find, 25% insert-or-add, 25% erase, over twice as
+//           many names as there are people (so about half the erases hit)
+// All times are ns per operation.
+//
+// g++ -std=c++17 -O2 -o main datastructures/swiss_map_bench.cpp && ./main [max_people]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "swiss_map.hpp"
+
+using namespace std;
+
+#define LOOKUPS 1000000
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned seed = 1;
+static unsigned next_random() {
+	seed = seed * 1103515245u + 12345u;
+	return seed >> 1;
+}
+
+// ===== ONE INTERFACE FOR ALL FOUR =====
+// h = the key's SwissMap hash; only the hashed version uses it
+
+struct HashedSwissMap {
+	SwissMap<string, int> map;
+};
+
+using OrderedMap = map<string, int, less<>>;
+using HashMap = unordered_map<string, int>;
+
+static const int* lookup(const OrderedMap &m, string_view key, uint64_t) {
+	auto it = m.find(key);
+	return it == m.end() ? nullptr : &it->second;
+}
+static const int* lookup(const HashMap &m, string_view key, uint64_t) {
+	auto it = m.find(string(key));
+	return it == m.end() ? nullptr : &it->second;
+}
+static const int* lookup(const SwissMap<string, int> &m, string_view key, uint64_t) {
+	auto it = m.find(key);
+	return it == m.end() ? nullptr : &it->second;
+}
+static const int* lookup(const HashedSwissMap &m, string_view key, uint64_t h) {
+	auto it = m.map.find(key, h);
+	return it == m.map.end() ? nullptr : &it->second;
+}
+
+static void add(OrderedMap &m, string_view key, int value, uint64_t) {
+	auto it = m.find(key);
+	if (it != m.end()) it->second += value;
+	else m.emplace(key, value);
+}
+static void add(HashMap &m, string_view key, int value, uint64_t) { m[string(key)] += value; }
+static void add(SwissMap<string, int> &m, string_view key, int value, uint64_t) {
+	m.try_emplace(key, 0).first->second += value;
+}
+static void add(HashedSwissMap &m, string_view key, int value, uint64_t h) {
+	m.map.try_emplace_hashed(h, key, 0).first->second += value;
+}
+
+static size_t remove(OrderedMap &m, string_view key, uint64_t) {
+	auto it = m.find(key);   // erase(string_view) is C++23
+	if (it == m.end()) return 0;
+	m.erase(it);
+	return 1;
+}
+static size_t remove(HashMap &m, string_view key, uint64_t) { return m.erase(string(key)); }
+static size_t remove(SwissMap<string, int> &m, string_view key, uint64_t) { return m.erase(key); }
+static size_t remove(HashedSwissMap &m, string_view key, uint64_t h) { return m.map.erase(key, h); }
+
+static size_t size_of(const OrderedMap &m) { return m.size(); }
+static size_t size_of(const HashMap &m) { return m.size(); }
+static size_t size_of(const SwissMap<string, int> &m) { return m.size(); }
+static size_t size_of(const HashedSwissMap &m) { return m.map.size(); }
+
+// ===== WORKLOAD =====
+
+struct Workload {
+	vector<string> names;        // 2 * people: the first half are people
+	vector<int> ages;
+	vector<uint64_t> hashes;     // SwissHash of every name
+	vector<size_t> queries;      // Name index per lookup
+	vector<size_t> op_keys;      // Name index per mixed operation
+	vector<unsigned char> ops;   // 0, 1 = find, 2 = add, 3 = erase
+};
+
+template <typename Map>
+static void run(const char *name, const Workload &w, size_t people, long long *check) {
+	Map m;
+	double start = now_sec();
+	for (size_t i = 0; i < people; i++) add(m, w.names[i], w.ages[i], w.hashes[i]);
+	double insert_sec = now_sec() - start;
+
+	long long sum = 0;
+	start = now_sec();
+	for (size_t q : w.queries) {
+		const int *age = lookup(m, w.names[q], w.hashes[q]);
+		if (age) sum += *age;
+	}
+	double find_sec = now_sec() - start;
+
+	size_t erased = 0;
+	start = now_sec();
+	for (size_t i = 0; i < people; i += 2) erased += remove(m, w.names[i], w.hashes[i]);
+	double erase_sec = now_sec() - start;
+
+	start = now_sec();
+	for (size_t i = 0; i < w.ops.size(); i++) {
+		size_t k = w.op_keys[i];
+		if (w.ops[i] < 2) {
+			const int *age = lookup(m, w.names[k], w.hashes[k]);
+			if (age) sum += *age;
+		} else if (w.ops[i] == 2) {
+			add(m, w.names[k], 1, w.hashes[k]);
+		} else {
+			erased += remove(m, w.names[k], w.hashes[k]);
+		}
+	}
+	double mixed_sec = now_sec() - start;
+
+	// Same sum of lookups, erase count and final size in every version
+	*check = sum * 31 + (long long)erased * 7 + (long long)size_of(m);
+	printf("  %-20s %8.1f %8.1f %8.1f %8.1f\n", name, insert_sec / people * 1e9, find_sec / LOOKUPS * 1e9,
+	       erase_sec / ((people + 1) / 2) * 1e9, mixed_sec / w.ops.size() * 1e9);
+	fflush(stdout);
+}
+
+int main(int argc, char *argv[]) {
+	size_t max_people = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+	if (max_people < 1000) max_people = 1000;
+	bool agree = true;
+	SwissHash<string> hash;
+
+	printf("%zu lookups and %zu mixed operations per size, ns per operation\n", (size_t)LOOKUPS, (size_t)LOOKUPS);
+
+	for (size_t people = 1000; people <= max_people; people *= 10) {
+		Workload w;
+		w.names.resize(2 * people);
+		for (size_t i = 0; i < 2 * people; i++) {
+			w.names[i] = "person-" + to_string(next_random() % 100000) + "-" + to_string(i);
+			w.ages.push_back((int)(next_random() % 90));
+			w.hashes.push_back(hash(w.names[i]));
+		}
+		for (size_t q = 0; q < LOOKUPS; q++) {
+			// 90% people, 10% names that were never added
+			w.queries.push_back(next_random() % 10 ? next_random() % people : people + next_random() % people);
+			w.ops.push_back((unsigned char)(next_random() % 4));
+			w.op_keys.push_back(next_random() % (2 * people));
+		}
+
+		printf("\n%zu people:%14s %8s %8s %8s\n", people, "insert", "find", "erase", "mixed");
+		long long checks[4];
+		run<OrderedMap>("std::map", w, people, &checks[0]);
+		run<HashMap>("std::unordered_map", w, people, &checks[1]);
+		run<SwissMap<string, int>>("SwissMap", w, people, &checks[2]);
+		run<HashedSwissMap>("SwissMap, hashed", w, people, &checks[3]);
+		agree &= checks[0] == checks[1] && checks[0] == checks[2] && checks[0] == checks[3];
+	}
+
+	printf("\n%s\n", agree ? "all versions agree" : "MISMATCH between versions!");
+	return 0;
+}
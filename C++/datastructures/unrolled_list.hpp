@@ -0,0 +1,360 @@
+// C++ UnrolledList Summary
+//
+// A linked list whose nodes each hold a small ARRAY of elements, with the std::list
+// surface used in c02_lists.cpp: front, back, push_front, push_back, pop_front,
+// pop_back, insert / erase at an iterator (e.g. next(cars.begin(), 2)), size,
+// empty, clear, for-each loops, plus splice.
+//
+// std::list has one node per element, each allocated on its own: walking the list
+// is one pointer hop - and usually one cache miss - per element. Here a node holds
+// up to Cap elements side by side (~512 bytes of them by default), so a walk reads
+// whole arrays and hops once per Cap elements.
+//
+//   - insert in the middle shifts at most Cap elements inside ONE node; a full
+//     node is split in two (half of it moves to a new node)
+//   - erase shifts inside its node; a node that drops below half full takes over
+//     its next neighbour when both fit in one node, so nodes stay dense
+//   - splice(pos, other) links all of other's nodes in: O(1) in the length of
+//     either list (at most one node is split at pos)
+//
+// Iterators are "stable-ish": insert and erase only invalidate iterators into the
+// node they touch (and the neighbour on a split or merge). Iterators into every
+// other node stay valid, unlike a vector's; std::list's never move at all.
+//
+// Every linked node holds at least one element: a new node is filled BEFORE it
+// is linked, so a throwing T constructor never leaves an empty node behind.
+//
+// Needs C++17:
+//   g++ -std=c++17 -O2 -o main datastructures/unrolled_list_bench.cpp && ./main
+
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t Cap = (sizeof(T) * 8 <= 512 ? 512 / sizeof(T) : 8)>
+class UnrolledList {
+	static_assert(Cap >= 2, "nodes need room for at least 2 elements");
+
+	struct Node {
+		Node *prev = nullptr;
+		Node *next = nullptr;
+		size_t count = 0;
+		alignas(T) unsigned char storage[sizeof(T) * Cap];
+
+		T* items() { return std::launder(reinterpret_cast<T*>(storage)); }
+		T& operator[](size_t i) { return items()[i]; }
+	};
+
+public:
+	using value_type = T;
+	using size_type = size_t;
+
+	template <bool Const>
+	class Iterator {
+		using List = std::conditional_t<Const, const UnrolledList, UnrolledList>;
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::conditional_t<Const, const T&, T&>;
+		using pointer = std::conditional_t<Const, const T*, T*>;
+
+		Iterator() = default;
+		operator Iterator<true>() const { return Iterator<true>(list_, node_, i_); }
+
+		reference operator*() const { return (*node_)[i_]; }
+		pointer operator->() const { return &(*node_)[i_]; }
+
+		Iterator& operator++() {
+			if (++i_ == node_->count) {
+				node_ = node_->next;
+				i_ = 0;
+			}
+			return *this;
+		}
+		Iterator operator++(int) {
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+		Iterator& operator--() {
+			if (node_ == nullptr) {   // end() - 1 = last element
+				node_ = list_->tail_;
+				i_ = node_->count - 1;
+			} else if (i_ == 0) {
+				node_ = node_->prev;
+				i_ = node_->count - 1;
+			} else {
+				i_--;
+			}
+			return *this;
+		}
+		Iterator operator--(int) {
+			Iterator old = *this;
+			--*this;
+			return old;
+		}
+
+		bool operator==(const Iterator &other) const { return node_ == other.node_ && i_ == other.i_; }
+		bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+	private:
+		friend class UnrolledList;
+		template <bool>
+		friend class Iterator;
+		Iterator(List *list, Node *node, size_t i) : list_(list), node_(node), i_(i) {}
+
+		List *list_ = nullptr;
+		Node *node_ = nullptr;   // nullptr = end()
+		size_t i_ = 0;
+	};
+
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	// ===== CONSTRUCT / DESTROY =====
+
+	UnrolledList() = default;
+
+	UnrolledList(std::initializer_list<T> items) { append_all(items); }
+
+	UnrolledList(const UnrolledList &other) { append_all(other); }
+
+	UnrolledList(UnrolledList &&other) noexcept { swap(other); }
+
+	UnrolledList& operator=(UnrolledList other) noexcept {
+		swap(other);
+		return *this;
+	}
+
+	~UnrolledList() { clear(); }
+
+	void swap(UnrolledList &other) noexcept {
+		std::swap(head_, other.head_);
+		std::swap(tail_, other.tail_);
+		std::swap(size_, other.size_);
+	}
+
+	// ===== ACCESS =====
+
+	T& front() { return (*head_)[0]; }
+	const T& front() const { return (*head_)[0]; }
+	T& back() { return (*tail_)[tail_->count - 1]; }
+	const T& back() const { return (*tail_)[tail_->count - 1]; }
+
+	size_t size() const noexcept { return size_; }
+	bool empty() const noexcept { return size_ == 0; }
+
+	iterator begin() noexcept { return iterator(this, head_, 0); }
+	iterator end() noexcept { return iterator(this, nullptr, 0); }
+	const_iterator begin() const noexcept { return const_iterator(this, head_, 0); }
+	const_iterator end() const noexcept { return const_iterator(this, nullptr, 0); }
+
+	// ===== ADD =====
+
+	void push_back(T value) {
+		if (tail_ == nullptr || tail_->count == Cap) {
+			link_after(tail_, node_with(std::move(value)));
+		} else {
+			new (&(*tail_)[tail_->count]) T(std::move(value));
+			tail_->count++;
+		}
+		size_++;
+	}
+
+	void push_front(T value) {
+		if (head_ == nullptr || head_->count == Cap) {
+			link_after(nullptr, node_with(std::move(value)));
+			size_++;
+		} else {
+			insert_at(head_, 0, std::move(value));
+		}
+	}
+
+	// Insert before pos; returns the new element
+	iterator insert(const_iterator pos, T value) {
+		if (pos.node_ == nullptr) {
+			push_back(std::move(value));
+			return iterator(this, tail_, tail_->count - 1);
+		}
+		Node *node = pos.node_;
+		size_t i = pos.i_;
+		// In front of a node: the end of the previous node is the same place
+		if (i == 0 && node->prev != nullptr && node->prev->count < Cap) {
+			node = node->prev;
+			i = node->count;
+		} else if (node->count == Cap) {
+			split(node, Cap / 2);
+			if (i > Cap / 2) {
+				i -= Cap / 2;
+				node = node->next;
+			}
+		}
+		insert_at(node, i, std::move(value));
+		return iterator(this, node, i);
+	}
+
+	// ===== REMOVE =====
+
+	void pop_front() { erase(begin()); }
+	void pop_back() { erase(iterator(this, tail_, tail_->count - 1)); }
+
+	// Returns the element after the erased one
+	iterator erase(const_iterator pos) {
+		Node *node = pos.node_;
+		size_t i = pos.i_;
+		T *items = node->items();
+		std::move(items + i + 1, items + node->count, items + i);
+		items[node->count - 1].~T();
+		node->count--;
+		size_--;
+
+		if (node->count == 0) {
+			Node *next = node->next;
+			unlink(node);
+			return iterator(this, next, 0);
+		}
+		// Keep nodes dense: an under-half node absorbs its next neighbour if they fit
+		Node *next = node->next;
+		if (next != nullptr && node->count < Cap / 2 && node->count + next->count <= Cap) {
+			move_items(next, 0, node);
+			unlink(next);
+		}
+		if (i < node->count) return iterator(this, node, i);
+		return iterator(this, node->next, 0);
+	}
+
+	void clear() noexcept {
+		while (head_ != nullptr) {
+			Node *next = head_->next;
+			for (size_t i = 0; i < head_->count; i++) (*head_)[i].~T();
+			delete head_;
+			head_ = next;
+		}
+		tail_ = nullptr;
+		size_ = 0;
+	}
+
+	// ===== SPLICE =====
+
+	// Move ALL of other's elements in before pos, without copying or moving any of
+	// them: only node links change (plus one split of pos's node, if pos is mid-node)
+	void splice(const_iterator pos, UnrolledList &other) {
+		if (other.head_ == nullptr || &other == this) return;
+		Node *after;   // other's nodes go after this one (nullptr = at the front)
+		if (pos.node_ == nullptr) {
+			after = tail_;
+		} else {
+			if (pos.i_ > 0) split(pos.node_, pos.i_);
+			after = pos.i_ > 0 ? pos.node_ : pos.node_->prev;
+		}
+		Node *before = after ? after->next : head_;
+		other.head_->prev = after;
+		other.tail_->next = before;
+		(after ? after->next : head_) = other.head_;
+		(before ? before->prev : tail_) = other.tail_;
+		size_ += other.size_;
+		other.head_ = other.tail_ = nullptr;
+		other.size_ = 0;
+	}
+
+	void splice(const_iterator pos, UnrolledList &&other) { splice(pos, other); }
+
+private:
+	template <typename Items>
+	void append_all(const Items &items) {
+		try {
+			for (const T &item : items) push_back(item);
+		} catch (...) {
+			clear();   // The destructor doesn't run for a constructor that throws
+			throw;
+		}
+	}
+
+	// A new, unlinked node holding just `value`
+	static Node* node_with(T &&value) {
+		Node *node = new Node;
+		try {
+			new (&(*node)[0]) T(std::move(value));
+		} catch (...) {
+			delete node;
+			throw;
+		}
+		node->count = 1;
+		return node;
+	}
+
+	// Insert into a node with room, shifting the elements from i on
+	void insert_at(Node *node, size_t i, T &&value) {
+		T *items = node->items();
+		if (i == node->count) {
+			new (&items[i]) T(std::move(value));
+			node->count++;
+			size_++;
+		} else {
+			new (&items[node->count]) T(std::move(items[node->count - 1]));
+			node->count++;   // Counted as soon as it exists: a throw below leaves no stray element
+			size_++;
+			std::move_backward(items + i, items + node->count - 2, items + node->count - 1);
+			items[i] = std::move(value);
+		}
+	}
+
+	// Elements [from, end) of `source` appended to `target` (which has room).
+	// All are moved before any is destroyed: if a move throws, target is put back
+	static void move_items(Node *source, size_t from, Node *target) {
+		size_t n = source->count - from;
+		size_t k = 0;
+		try {
+			for (; k < n; k++) new (&(*target)[target->count + k]) T(std::move((*source)[from + k]));
+		} catch (...) {
+			while (k > 0) (*target)[target->count + --k].~T();
+			throw;
+		}
+		for (k = 0; k < n; k++) (*source)[from + k].~T();
+		target->count += n;
+		source->count = from;
+	}
+
+	// Elements from `at` on move to a new node right after `node`
+	void split(Node *node, size_t at) {
+		Node *fresh = new Node;
+		try {
+			move_items(node, at, fresh);
+		} catch (...) {
+			delete fresh;
+			throw;
+		}
+		link_after(node, fresh);
+	}
+
+	// after == nullptr: link at the front
+	void link_after(Node *after, Node *node) noexcept {
+		Node *before = after ? after->next : head_;
+		node->prev = after;
+		node->next = before;
+		(after ? after->next : head_) = node;
+		(before ? before->prev : tail_) = node;
+	}
+
+	// Unlinks and frees an EMPTY node
+	void unlink(Node *node) noexcept {
+		(node->prev ? node->prev->next : head_) = node->next;
+		(node->next ? node->next->prev : tail_) = node->prev;
+		delete node;
+	}
+
+	Node *head_ = nullptr;
+	Node *tail_ = nullptr;
+	size_t size_ = 0;
+};
+
+#endif
@@ -0,0 +1,133 @@
+// C++ UnrolledList Benchmark
+//
+// UnrolledList (unrolled_list.hpp) vs std::list<string> and std::deque<string> on
+// the c02_lists.cpp operations, with N car names in sorted order:
+//   traverse      for-each over every car, summing name lengths (ns per element)
+//   cursor insert keep an iterator in the middle and insert in front of it, like an
+//                 editor cursor: it = cars.insert(it, "Chevy"); ++it;
+//   next() insert cars.insert(next(cars.begin(), k), "Chevy") at random k: walk there
+//                 first, as c02_lists.cpp does (deque's next() is a jump, not a walk)
+// The std::list is put in order with list::sort(), which relinks nodes without
+// moving them: like a list that has lived a while, consecutive elements are
+// scattered around the heap. The deque and UnrolledList are filled in order.
+//
+// g++ -std=c++17 -O2 -o main datastructures/unrolled_list_bench.cpp && ./main [count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "unrolled_list.hpp"
+
+using namespace std;
+
+#define TRAVERSALS 10
+#define NEXT_INSERTS 100
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void report(const char *name, double seconds, size_t count) {
+	printf("  %-14s %9.2f ms  %10.1f ns/op\n", name, seconds * 1e3, seconds / count * 1e9);
+}
+
+template <typename List>
+static size_t traverse(const List &cars) {
+	size_t length = 0;
+	for (int r = 0; r < TRAVERSALS; r++) {
+		for (const string &car : cars) length += car.size();
+	}
+	return length;
+}
+
+template <typename List>
+static void cursor_insert(List &cars, typename List::iterator it, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		it = cars.insert(it, "Chevy");
+		++it;
+	}
+}
+
+template <typename List>
+static void next_insert(List &cars, const vector<size_t> &positions) {
+	for (size_t k : positions) cars.insert(next(cars.begin(), k), "Chevy");
+}
+
+template <typename A, typename B>
+static bool same(const A &a, const B &b) {
+	return a.size() == b.size() && equal(a.begin(), a.end(), b.begin());
+}
+
+int main(int argc, char *argv[]) {
+	size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+	if (count < 100) count = 100;
+	size_t cursor_inserts = count / 500;   // deque shifts half of everything per insert: keep them few
+
+	const char *brands[] = {"Volvo", "BMW", "Ford", "Mazda", "Tesla", "VW", "Opel", "Toyota"};
+	vector<string> names(count);
+	for (size_t i = 0; i < count; i++) names[i] = string(brands[i % 8]) + to_string(i * 2654435761u % 1000000);
+	vector<string> sorted_names = names;
+	sort(sorted_names.begin(), sorted_names.end());
+
+	list<string> std_list(names.begin(), names.end());
+	std_list.sort();
+	deque<string> std_deque(sorted_names.begin(), sorted_names.end());
+	UnrolledList<string> unrolled;
+	for (const string &name : sorted_names) unrolled.push_back(name);
+	bool agree = same(std_list, std_deque) && same(std_list, unrolled);
+
+	printf("traverse %zu cars, %d times:\n", count, TRAVERSALS);
+	double start = now_sec();
+	size_t list_length = traverse(std_list);
+	report("std::list", now_sec() - start, count * TRAVERSALS);
+	start = now_sec();
+	size_t deque_length = traverse(std_deque);
+	report("std::deque", now_sec() - start, count * TRAVERSALS);
+	start = now_sec();
+	size_t unrolled_length = traverse(unrolled);
+	report("UnrolledList", now_sec() - start, count * TRAVERSALS);
+	agree &= list_length == deque_length && list_length == unrolled_length;
+
+	printf("cursor insert %zu cars in the middle:\n", cursor_inserts);
+	auto list_middle = next(std_list.begin(), count / 2);   // Walking there is not timed
+	auto deque_middle = next(std_deque.begin(), count / 2);
+	auto unrolled_middle = next(unrolled.begin(), count / 2);
+	start = now_sec();
+	cursor_insert(std_list, list_middle, cursor_inserts);
+	report("std::list", now_sec() - start, cursor_inserts);
+	start = now_sec();
+	cursor_insert(std_deque, deque_middle, cursor_inserts);
+	report("std::deque", now_sec() - start, cursor_inserts);
+	start = now_sec();
+	cursor_insert(unrolled, unrolled_middle, cursor_inserts);
+	report("UnrolledList", now_sec() - start, cursor_inserts);
+	agree &= same(std_list, std_deque) && same(std_list, unrolled);
+
+	vector<size_t> positions(NEXT_INSERTS);
+	unsigned seed = 1;
+	for (size_t &k : positions) {
+		seed = seed * 1103515245u + 12345u;
+		k = (seed >> 1) % std_list.size();
+	}
+	printf("next() insert %d cars at random positions:\n", NEXT_INSERTS);
+	start = now_sec();
+	next_insert(std_list, positions);
+	report("std::list", now_sec() - start, NEXT_INSERTS);
+	start = now_sec();
+	next_insert(std_deque, positions);
+	report("std::deque", now_sec() - start, NEXT_INSERTS);
+	start = now_sec();
+	next_insert(unrolled, positions);
+	report("UnrolledList", now_sec() - start, NEXT_INSERTS);
+	agree &= same(std_list, std_deque) && same(std_list, unrolled);
+
+	printf("\n%s\n", agree ? "all versions agree" : "MISMATCH between versions!");
+	return 0;
+}
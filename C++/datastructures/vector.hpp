@@ -0,0 +1,419 @@
+// C++ Vector<T> Template Summary
+//
+// Our own contiguous dynamic array, in the style of Box<T> (classes/c06_templates.cpp),
+// with the std::vector surface used in c01_vectors.cpp and basics/vectors.cpp:
+// push_back, emplace_back, insert, erase, [], at, front, back, reserve, iterators.
+//
+// What it adds over std::vector:
+//   - TRIVIAL RELOCATION: growing (and insert/erase in the middle) must move every
+//     element. std::vector move-constructs each one into the new block and destroys
+//     the old one. For types that can simply be memcpy'd to a new address, Vector
+//     moves the whole block with ONE memcpy/memmove and runs no destructors.
+//     Eligible: trivially copyable types, std::unique_ptr, and std::string on
+//     libc++ (macOS). libstdc++'s std::string points into itself, so it is moved
+//     the normal way. Opt your own types in with:
+//       template <> struct is_trivially_relocatable<MyType> : std::true_type {};
+//   - GROWTH FACTOR as a template argument: Vector<T, Alloc, GrowBy<3, 2>> grows 1.5x
+//     (like C/darray.h's growth policies)
+//   - ALLOCATOR-AWARE: all memory goes through std::allocator_traits<Alloc>,
+//     including reserve() and shrink_to_fit(); stateful allocators propagate
+//     on copy/move/swap as the allocator asks
+//
+// Needs C++17:
+//   g++ -std=c++17 -O2 -o main datastructures/vector_bench.cpp && ./main
+
+#ifndef VECTOR_HPP
+#define VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// ===== TRIVIALLY RELOCATABLE =====
+// "Move to a new address, then destroy the original" == memcpy the bytes
+
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T, typename D>
+struct is_trivially_relocatable<std::unique_ptr<T, D>> : is_trivially_relocatable<D> {};
+
+#ifdef _LIBCPP_VERSION
+// libc++'s string keeps its short-string buffer without a pointer to itself
+template <>
+struct is_trivially_relocatable<std::string> : std::true_type {};
+#endif
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// ===== GROWTH =====
+
+// New capacity = capacity * Num / Den (at least `needed`, at least 4)
+template <size_t Num, size_t Den = 1>
+struct GrowBy {
+	static_assert(Num > Den, "growth factor must be > 1");
+	static size_t next(size_t capacity, size_t needed) {
+		size_t grown = capacity < 4 ? 4 : capacity / Den * Num + capacity % Den * Num / Den;
+		return grown < needed ? needed : grown;
+	}
+};
+
+using Grow2x = GrowBy<2>;
+using Grow1_5x = GrowBy<3, 2>;
+
+namespace vector_detail {
+	// Does the allocator construct/destroy elements itself? Then bytes can't just be copied
+	template <typename A, typename T, typename = void>
+	struct custom_construct : std::false_type {};
+	template <typename A, typename T>
+	struct custom_construct<A, T, std::void_t<decltype(std::declval<A&>().construct(std::declval<T*>(), std::declval<T&&>()))>>
+		: std::true_type {};
+
+	template <typename A, typename T, typename = void>
+	struct custom_destroy : std::false_type {};
+	template <typename A, typename T>
+	struct custom_destroy<A, T, std::void_t<decltype(std::declval<A&>().destroy(std::declval<T*>()))>>
+		: std::true_type {};
+
+	// std::allocator still has (deprecated) construct/destroy in C++17, but they are just placement new / ~T()
+	template <typename A>
+	struct is_std_allocator : std::false_type {};
+	template <typename U>
+	struct is_std_allocator<std::allocator<U>> : std::true_type {};
+
+	template <typename A, typename T>
+	inline constexpr bool custom_construct_v = custom_construct<A, T>::value && !is_std_allocator<A>::value;
+	template <typename A, typename T>
+	inline constexpr bool custom_destroy_v = custom_destroy<A, T>::value && !is_std_allocator<A>::value;
+}
+
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = Grow2x>
+class Vector {
+	using Traits = std::allocator_traits<Alloc>;
+
+public:
+	using value_type = T;
+	using allocator_type = Alloc;
+	using size_type = size_t;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+	// memcpy instead of move + destroy
+	static constexpr bool relocate_by_memcpy = is_trivially_relocatable_v<T> &&
+		!vector_detail::custom_construct_v<Alloc, T> && !vector_detail::custom_destroy_v<Alloc, T>;
+
+	// ===== CONSTRUCT / DESTROY =====
+
+	Vector() noexcept(noexcept(Alloc())) : Vector(Alloc()) {}
+	explicit Vector(const Alloc &alloc) noexcept : alloc_(alloc) {}
+
+	Vector(size_t count, const T &value, const Alloc &alloc = Alloc()) : alloc_(alloc) {
+		reserve(count);
+		for (size_t i = 0; i < count; i++) emplace_back(value);
+	}
+
+	Vector(std::initializer_list<T> items, const Alloc &alloc = Alloc()) : alloc_(alloc) {
+		reserve(items.size());
+		for (const T &item : items) emplace_back(item);
+	}
+
+	Vector(const Vector &other)
+		: alloc_(Traits::select_on_container_copy_construction(other.alloc_)) {
+		reserve(other.size_);
+		for (const T &item : other) emplace_back(item);
+	}
+
+	Vector(Vector &&other) noexcept
+		: alloc_(std::move(other.alloc_)), data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+		other.data_ = nullptr;
+		other.size_ = other.capacity_ = 0;
+	}
+
+	Vector& operator=(const Vector &other) {
+		if (this == &other) return *this;
+		if constexpr (Traits::propagate_on_container_copy_assignment::value) {
+			if (alloc_ != other.alloc_) release();   // Old memory belongs to the old allocator
+			alloc_ = other.alloc_;
+		}
+		clear();
+		reserve(other.size_);
+		for (const T &item : other) emplace_back(item);
+		return *this;
+	}
+
+	Vector& operator=(Vector &&other) noexcept(Traits::propagate_on_container_move_assignment::value ||
+	                                           Traits::is_always_equal::value) {
+		if (this == &other) return *this;
+		if (Traits::propagate_on_container_move_assignment::value || alloc_ == other.alloc_) {
+			release();
+			if constexpr (Traits::propagate_on_container_move_assignment::value) alloc_ = std::move(other.alloc_);
+			data_ = other.data_;
+			size_ = other.size_;
+			capacity_ = other.capacity_;
+			other.data_ = nullptr;
+			other.size_ = other.capacity_ = 0;
+		} else {
+			// Different allocators that don't travel: move element by element
+			clear();
+			reserve(other.size_);
+			for (T &item : other) emplace_back(std::move(item));
+			other.clear();
+		}
+		return *this;
+	}
+
+	~Vector() { release(); }
+
+	// ===== ACCESS =====
+
+	T& operator[](size_t i) { return data_[i]; }
+	const T& operator[](size_t i) const { return data_[i]; }
+
+	T& at(size_t i) {
+		if (i >= size_) throw std::out_of_range("Vector::at");
+		return data_[i];
+	}
+	const T& at(size_t i) const {
+		if (i >= size_) throw std::out_of_range("Vector::at");
+		return data_[i];
+	}
+
+	T& front() { return data_[0]; }
+	const T& front() const { return data_[0]; }
+	T& back() { return data_[size_ - 1]; }
+	const T& back() const { return data_[size_ - 1]; }
+	T* data() noexcept { return data_; }
+	const T* data() const noexcept { return data_; }
+
+	iterator begin() noexcept { return data_; }
+	iterator end() noexcept { return data_ + size_; }
+	const_iterator begin() const noexcept { return data_; }
+	const_iterator end() const noexcept { return data_ + size_; }
+
+	size_t size() const noexcept { return size_; }
+	size_t capacity() const noexcept { return capacity_; }
+	bool empty() const noexcept { return size_ == 0; }
+	size_t max_size() const noexcept { return Traits::max_size(alloc_); }
+	Alloc get_allocator() const { return alloc_; }
+
+	// ===== CAPACITY =====
+
+	void reserve(size_t new_capacity) {
+		if (new_capacity > capacity_) reallocate(new_capacity);
+	}
+
+	void shrink_to_fit() {
+		if (size_ == capacity_) return;
+		if (size_ == 0) release();
+		else reallocate(size_);
+	}
+
+	void resize(size_t count) {
+		if (count < size_) destroy_tail(count);
+		else {
+			reserve(count);
+			while (size_ < count) emplace_back();
+		}
+	}
+
+	void clear() noexcept { destroy_tail(0); }
+
+	// ===== ADD / REMOVE AT THE END =====
+
+	void push_back(const T &value) { emplace_back(value); }
+	void push_back(T &&value) { emplace_back(std::move(value)); }
+
+	template <typename... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity_) return grow_and_emplace(std::forward<Args>(args)...);
+		Traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+		return data_[size_++];
+	}
+
+	void pop_back() {
+		Traits::destroy(alloc_, data_ + size_ - 1);
+		size_--;
+	}
+
+	// ===== INSERT / ERASE ANYWHERE =====
+	// Everything after pos shifts by one: one memmove for relocatable types
+
+	iterator insert(const_iterator pos, const T &value) { return emplace(pos, value); }
+	iterator insert(const_iterator pos, T &&value) { return emplace(pos, std::move(value)); }
+
+	template <typename... Args>
+	iterator emplace(const_iterator pos, Args&&... args) {
+		size_t index = size_t(pos - data_);
+		if (index == size_) {
+			emplace_back(std::forward<Args>(args)...);
+			return data_ + index;
+		}
+		// Build the new element first: args may refer to an element that is about to move
+		Slot slot;
+		T *fresh = slot.ptr();
+		Traits::construct(alloc_, fresh, std::forward<Args>(args)...);
+		if (size_ == capacity_) {
+			try {
+				reallocate(Growth::next(capacity_, size_ + 1));
+			} catch (...) {
+				Traits::destroy(alloc_, fresh);
+				throw;
+			}
+		}
+		T *at = data_ + index;
+		if constexpr (relocate_by_memcpy) {
+			std::memmove(static_cast<void*>(at + 1), static_cast<const void*>(at), (size_ - index) * sizeof(T));
+			std::memcpy(static_cast<void*>(at), static_cast<const void*>(fresh), sizeof(T));   // fresh now lives at `at`
+			size_++;
+		} else {
+			try {
+				Traits::construct(alloc_, data_ + size_, std::move(data_[size_ - 1]));
+				size_++;   // The new last element is live: a throw below leaves it in the vector
+				std::move_backward(at, data_ + size_ - 2, data_ + size_ - 1);
+				*at = std::move(*fresh);
+			} catch (...) {
+				Traits::destroy(alloc_, fresh);
+				throw;
+			}
+			Traits::destroy(alloc_, fresh);
+		}
+		return at;
+	}
+
+	iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+	iterator erase(const_iterator first, const_iterator last) {
+		T *from = data_ + (first - data_);
+		T *to = data_ + (last - data_);
+		if (from == to) return from;
+		size_t removed = size_t(to - from);
+		if constexpr (relocate_by_memcpy) {
+			for (T *p = from; p != to; p++) Traits::destroy(alloc_, p);
+			std::memmove(static_cast<void*>(from), static_cast<const void*>(to), size_t(end() - to) * sizeof(T));
+			size_ -= removed;
+		} else {
+			std::move(to, end(), from);
+			destroy_tail(size_ - removed);
+		}
+		return from;
+	}
+
+	void swap(Vector &other) noexcept {
+		if constexpr (Traits::propagate_on_container_swap::value) {
+			using std::swap;
+			swap(alloc_, other.alloc_);
+		}
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		std::swap(capacity_, other.capacity_);
+	}
+
+private:
+	// Raw, correctly aligned room for one T (no constructor runs)
+	struct Slot {
+		alignas(T) unsigned char bytes[sizeof(T)];
+		T* ptr() { return reinterpret_cast<T*>(bytes); }
+	};
+
+	// Moves every element into a new block of new_capacity
+	void reallocate(size_t new_capacity) {
+		if (new_capacity > max_size()) throw std::length_error("Vector too large");
+		T *fresh = Traits::allocate(alloc_, new_capacity);
+		try {
+			relocate_into(fresh);
+		} catch (...) {
+			Traits::deallocate(alloc_, fresh, new_capacity);
+			throw;
+		}
+		if (data_) Traits::deallocate(alloc_, data_, capacity_);
+		data_ = fresh;
+		capacity_ = new_capacity;
+	}
+
+	// Old elements -> fresh; afterwards the old block holds no live objects.
+	// If it throws, the old elements are untouched and fresh holds nothing
+	void relocate_into(T *fresh) {
+		if constexpr (relocate_by_memcpy) {
+			if (size_) std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(data_), size_ * sizeof(T));
+		} else {
+			size_t done = 0;
+			try {
+				// move_if_noexcept: copy instead if moving could throw, so a failure leaves *this intact
+				for (; done < size_; done++) Traits::construct(alloc_, fresh + done, std::move_if_noexcept(data_[done]));
+			} catch (...) {
+				for (size_t i = 0; i < done; i++) Traits::destroy(alloc_, fresh + i);
+				throw;
+			}
+			for (size_t i = 0; i < size_; i++) Traits::destroy(alloc_, data_ + i);
+		}
+	}
+
+	template <typename... Args>
+	T& grow_and_emplace(Args&&... args) {
+		size_t new_capacity = Growth::next(capacity_, size_ + 1);
+		if (new_capacity > max_size()) throw std::length_error("Vector too large");
+		T *fresh = Traits::allocate(alloc_, new_capacity);
+		// New element first: args may point into the old block (v.push_back(v[0]))
+		try {
+			Traits::construct(alloc_, fresh + size_, std::forward<Args>(args)...);
+		} catch (...) {
+			Traits::deallocate(alloc_, fresh, new_capacity);
+			throw;
+		}
+		try {
+			relocate_into(fresh);
+		} catch (...) {
+			Traits::destroy(alloc_, fresh + size_);
+			Traits::deallocate(alloc_, fresh, new_capacity);
+			throw;
+		}
+		if (data_) Traits::deallocate(alloc_, data_, capacity_);
+		data_ = fresh;
+		capacity_ = new_capacity;
+		return data_[size_++];
+	}
+
+	void destroy_tail(size_t new_size) noexcept {
+		if constexpr (!std::is_trivially_destructible_v<T> || vector_detail::custom_destroy_v<Alloc, T>) {
+			for (size_t i = new_size; i < size_; i++) Traits::destroy(alloc_, data_ + i);
+		}
+		size_ = new_size;
+	}
+
+	void release() noexcept {
+		clear();
+		if (data_) Traits::deallocate(alloc_, data_, capacity_);
+		data_ = nullptr;
+		capacity_ = 0;
+	}
+
+	Alloc alloc_;
+	T *data_ = nullptr;
+	size_t size_ = 0;
+	size_t capacity_ = 0;
+};
+
+template <typename T, typename A, typename G>
+bool operator==(const Vector<T, A, G> &a, const Vector<T, A, G> &b) {
+	return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+template <typename T, typename A, typename G>
+bool operator!=(const Vector<T, A, G> &a, const Vector<T, A, G> &b) {
+	return !(a == b);
+}
+
+template <typename T, typename A, typename G>
+void swap(Vector<T, A, G> &a, Vector<T, A, G> &b) noexcept {
+	a.swap(b);
+}
+
+#endif
@@ -0,0 +1,210 @@
+// C++ Vector<T> Benchmark
+//
+// Vector (vector.hpp) vs std::vector on the cars / fruits operations from
+// c01_vectors.cpp and basics/vectors.cpp, with a mix of short car names
+// (fit inside std::string) and long ones (heap-allocated):
+//   1. push_back N cars (no reserve: every growth moves all elements)
+//   2. insert at the front, like cars.insert(cars.begin(), "Honda")
+//   3. insert + erase at index 2, like cars.insert(cars.begin() + 2, "Chevy")
+//   4. erase the first fruit until none are left
+// Then the same with unique_ptr<string>, which is trivially relocatable
+// everywhere, and allocation counts for 2x vs 1.5x growth vs reserve().
+// With libstdc++ (Linux) std::string is NOT relocatable, so Vector<string>
+// moves strings like std::vector does; on libc++ (macOS) it memcpy's them.
+//
+// g++ -std=c++17 -O2 -o main datastructures/vector_bench.cpp && ./main [count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vector.hpp"
+
+using namespace std;
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void report(const char *name, double seconds, size_t count) {
+	printf("  %-34s %9.2f ms  %8.1f ns/op\n", name, seconds * 1e3, seconds / count * 1e9);
+}
+
+static const char *car_names[] = {"Volvo", "BMW", "Ford", "Mazda", "Honda", "Chevy", "Tesla", "VW"};
+static const char *fruit_names[] = {"apple", "banana", "cherry", "date", "kiwi", "blueberry"};
+
+// Every 4th name is too long for the short-string buffer
+static string make_name(const char *base, size_t i) {
+	if (i % 4 == 3) return string(base) + " limited edition #" + to_string(i);
+	return string(base) + to_string(i % 100);
+}
+
+template <typename A, typename B>
+static bool same(const A &a, const B &b) {
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i] != b[i]) return false;
+	}
+	return true;
+}
+
+// ===== STRING WORKLOADS =====
+
+template <typename Vec>
+static Vec push_cars(const vector<string> &names) {
+	Vec cars;
+	for (const string &name : names) cars.push_back(name);
+	return cars;
+}
+
+template <typename Vec>
+static Vec insert_front(const vector<string> &names, size_t count) {
+	Vec cars;
+	for (size_t i = 0; i < count; i++) cars.insert(cars.begin(), names[i]);
+	return cars;
+}
+
+template <typename Vec>
+static void insert_erase_middle(Vec &cars, const vector<string> &names, size_t rounds) {
+	for (size_t i = 0; i < rounds; i++) {
+		cars.insert(cars.begin() + 2, names[i % names.size()]);
+		cars.erase(cars.begin() + 2 + (i % 3));
+	}
+}
+
+template <typename Vec>
+static size_t erase_fruits(Vec &fruits) {
+	size_t length = 0;
+	while (!fruits.empty()) {
+		length += fruits.front().size();
+		fruits.erase(fruits.begin());
+	}
+	return length;
+}
+
+// ===== unique_ptr WORKLOAD =====
+
+template <typename Vec>
+static size_t owned_cars(const vector<string> &names, size_t front_inserts) {
+	Vec cars, front;
+	for (const string &name : names) cars.push_back(make_unique<string>(name));
+	for (size_t i = 0; i < front_inserts; i++) front.insert(front.begin(), make_unique<string>(names[i]));
+	size_t length = 0;
+	for (const auto &car : cars) length += car->size();
+	for (size_t i = 0; i < front.size(); i++) length += front[i]->size() * i;
+	return length;
+}
+
+// ===== ALLOCATOR =====
+
+struct AllocStats {
+	size_t allocations = 0, bytes = 0, peak = 0, live = 0;
+};
+
+// Minimal stateful allocator: counts what the container asks for
+template <typename T>
+struct CountingAllocator {
+	using value_type = T;
+	AllocStats *stats;
+
+	explicit CountingAllocator(AllocStats *s) : stats(s) {}
+	template <typename U>
+	CountingAllocator(const CountingAllocator<U> &other) : stats(other.stats) {}
+
+	T* allocate(size_t n) {
+		stats->allocations++;
+		stats->bytes += n * sizeof(T);
+		stats->live += n * sizeof(T);
+		if (stats->live > stats->peak) stats->peak = stats->live;
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+	void deallocate(T *p, size_t n) {
+		stats->live -= n * sizeof(T);
+		::operator delete(p);
+	}
+	bool operator==(const CountingAllocator &other) const { return stats == other.stats; }
+	bool operator!=(const CountingAllocator &other) const { return stats != other.stats; }
+};
+
+template <typename Growth>
+static void count_growth(const char *name, const vector<string> &names, bool reserve_first) {
+	AllocStats stats;
+	Vector<string, CountingAllocator<string>, Growth> cars{CountingAllocator<string>(&stats)};
+	if (reserve_first) cars.reserve(names.size());
+	for (const string &n : names) cars.push_back(n);
+	printf("  %-34s %6zu allocations  %8.1f MB requested  %7.1f MB peak\n", name,
+	       stats.allocations, stats.bytes / 1e6, stats.peak / 1e6);
+}
+
+int main(int argc, char *argv[]) {
+	size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000000;
+	if (count < 100) count = 100;
+	size_t shifts = count / 100;   // insert/erase near the front move every element: keep them fewer
+
+	vector<string> cars_list(count), fruits_list(shifts);
+	for (size_t i = 0; i < count; i++) cars_list[i] = make_name(car_names[i % 8], i);
+	for (size_t i = 0; i < shifts; i++) fruits_list[i] = make_name(fruit_names[i % 6], i);
+	bool agree = true;
+
+	printf("Vector<string> relocates by memcpy: %s\n\n", Vector<string>::relocate_by_memcpy ? "yes" : "no");
+
+	printf("push_back %zu cars:\n", count);
+	double start = now_sec();
+	auto std_cars = push_cars<vector<string>>(cars_list);
+	report("std::vector", now_sec() - start, count);
+	start = now_sec();
+	auto our_cars = push_cars<Vector<string>>(cars_list);
+	report("Vector", now_sec() - start, count);
+	agree &= same(std_cars, our_cars);
+
+	printf("insert %zu cars at the front:\n", shifts);
+	start = now_sec();
+	auto std_front = insert_front<vector<string>>(cars_list, shifts);
+	report("std::vector", now_sec() - start, shifts);
+	start = now_sec();
+	auto our_front = insert_front<Vector<string>>(cars_list, shifts);
+	report("Vector", now_sec() - start, shifts);
+	agree &= same(std_front, our_front);
+
+	printf("insert + erase at index 2 (%zu cars), %zu times:\n", std_front.size(), shifts);
+	start = now_sec();
+	insert_erase_middle(std_front, cars_list, shifts);
+	report("std::vector", now_sec() - start, shifts);
+	start = now_sec();
+	insert_erase_middle(our_front, cars_list, shifts);
+	report("Vector", now_sec() - start, shifts);
+	agree &= same(std_front, our_front);
+
+	printf("erase first fruit until empty (%zu fruits):\n", shifts);
+	vector<string> std_fruits(fruits_list.begin(), fruits_list.end());
+	Vector<string> our_fruits;
+	for (const string &f : fruits_list) our_fruits.push_back(f);
+	start = now_sec();
+	size_t std_length = erase_fruits(std_fruits);
+	report("std::vector", now_sec() - start, shifts);
+	start = now_sec();
+	size_t our_length = erase_fruits(our_fruits);
+	report("Vector", now_sec() - start, shifts);
+	agree &= std_length == our_length;
+
+	printf("unique_ptr<string>: push_back %zu + %zu front inserts (relocatable: %s):\n", count, shifts,
+	       Vector<unique_ptr<string>>::relocate_by_memcpy ? "yes" : "no");
+	start = now_sec();
+	size_t std_owned = owned_cars<vector<unique_ptr<string>>>(cars_list, shifts);
+	report("std::vector", now_sec() - start, count + shifts);
+	start = now_sec();
+	size_t our_owned = owned_cars<Vector<unique_ptr<string>>>(cars_list, shifts);
+	report("Vector", now_sec() - start, count + shifts);
+	agree &= std_owned == our_owned;
+
+	printf("allocations for %zu push_backs (CountingAllocator):\n", count);
+	count_growth<Grow2x>("Grow2x", cars_list, false);
+	count_growth<Grow1_5x>("Grow1_5x", cars_list, false);
+	count_growth<Grow2x>("reserve(count) first", cars_list, true);
+
+	printf("\n%s\n", agree ? "all versions agree" : "MISMATCH between versions!");
+	return 0;
+}
@@ -0,0 +1,291 @@
+#define ALLOC_TRACK_IMPL
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "alloc_track.h"
+
+// With `-include alloc_track.h` the macros already exist before ALLOC_TRACK_IMPL
+// is seen, so remove them: this file must call the REAL allocator
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+// ALLOCATION TRACKING - IMPLEMENTATION
+// ====================================
+// Every tracked block gets a hidden header in front of it:
+//
+//   [ BlockHeader | user data ... ]
+//                 ^ pointer returned to the program
+//
+// Headers form a doubly linked list of live blocks, so at exit we can walk
+// the list and print each leak with the file:line that allocated it
+//
+// realloc/free must not look in front of a pointer that isn't ours (strdup,
+// getline, ...): there may be no header there, or not even readable memory.
+// So the pointers we handed out are ALSO kept in a hash set (open addressing,
+// linear probing), and it answers "is this ours?" without touching the block
+
+#define MAX_LEAKS_SHOWN 20
+#define SET_MIN_CAPACITY 64
+
+typedef struct BlockHeader {
+    struct BlockHeader *prev;
+    struct BlockHeader *next;
+    const char *file;
+    size_t size;
+    int line;
+} BlockHeader;
+
+// Keep user data aligned like plain malloc would (16 bytes on 64-bit systems)
+typedef union {
+    BlockHeader header;
+    max_align_t align;
+} PaddedHeader;
+
+static BlockHeader *live_list = NULL;
+static void **live_set = NULL;     // User pointers of the live blocks (NULL = empty slot)
+static size_t set_capacity = 0;    // Power of two, at most half full
+static size_t set_count = 0;
+static AllocStats stats;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int bucket_for(size_t size) {
+    int bucket = 0;
+    while (size > 1 && bucket < ALLOC_TRACK_BUCKETS - 1) {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static BlockHeader* header_of(void *ptr) {
+    return &((PaddedHeader*)ptr - 1)->header;
+}
+
+static void* user_of(BlockHeader *h) {
+    return (PaddedHeader*)h + 1;
+}
+
+// ===== LIVE POINTER SET (caller holds the lock) =====
+
+// Slot holding ptr, or the empty slot where it would go
+static size_t set_slot(const void *ptr) {
+    size_t mask = set_capacity - 1;
+    size_t i = (size_t)(((uint64_t)(uintptr_t)ptr * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    while (live_set[i] != NULL && live_set[i] != ptr) i = (i + 1) & mask;
+    return i;
+}
+
+static int set_contains(const void *ptr) {
+    return set_count > 0 && live_set[set_slot(ptr)] == ptr;
+}
+
+// 0 = added, -1 = out of memory (set unchanged)
+static int set_add(void *ptr) {
+    if ((set_count + 1) * 2 > set_capacity) {
+        size_t old_capacity = set_capacity;
+        void **old = live_set;
+        size_t capacity = old_capacity == 0 ? SET_MIN_CAPACITY : old_capacity * 2;
+        void **fresh = calloc(capacity, sizeof(void*));
+        if (fresh == NULL) return -1;
+        live_set = fresh;
+        set_capacity = capacity;
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old[i] != NULL) live_set[set_slot(old[i])] = old[i];
+        }
+        free(old);
+    }
+    live_set[set_slot(ptr)] = ptr;
+    set_count++;
+    return 0;
+}
+
+// Backward-shift delete: later entries of the probe run move up, no tombstones
+static void set_remove(const void *ptr) {
+    size_t mask = set_capacity - 1;
+    size_t hole = set_slot(ptr);
+    live_set[hole] = NULL;
+    set_count--;
+    for (size_t i = (hole + 1) & mask; live_set[i] != NULL; i = (i + 1) & mask) {
+        void *moved = live_set[i];
+        live_set[i] = NULL;
+        live_set[set_slot(moved)] = moved;
+    }
+}
+
+// ===== LIVE LIST =====
+
+// Caller holds the lock. 0 = linked, -1 = out of memory (nothing changed)
+static int link_block(BlockHeader *h, size_t size, const char *file, int line) {
+    if (set_add(user_of(h)) != 0) return -1;
+    h->size = size;
+    h->file = file;
+    h->line = line;
+    h->prev = NULL;
+    h->next = live_list;
+    if (live_list != NULL) live_list->prev = h;
+    live_list = h;
+
+    stats.live_bytes += size;
+    stats.live_blocks++;
+    if (stats.live_bytes > stats.peak_bytes) stats.peak_bytes = stats.live_bytes;
+    stats.histogram[bucket_for(size)]++;
+    return 0;
+}
+
+// Caller holds the lock
+static void unlink_block(BlockHeader *h) {
+    if (h->prev != NULL) h->prev->next = h->next;
+    else live_list = h->next;
+    if (h->next != NULL) h->next->prev = h->prev;
+
+    stats.live_bytes -= h->size;
+    stats.live_blocks--;
+    set_remove(user_of(h));
+}
+
+void* track_malloc(size_t size, const char *file, int line) {
+    if (size > SIZE_MAX - sizeof(PaddedHeader)) return NULL;
+    PaddedHeader *p = malloc(sizeof(PaddedHeader) + size);
+    if (p == NULL) return NULL;
+
+    pthread_mutex_lock(&lock);
+    int linked = link_block(&p->header, size, file, line);
+    if (linked == 0) stats.malloc_calls++;
+    pthread_mutex_unlock(&lock);
+    if (linked != 0) {
+        free(p);
+        return NULL;
+    }
+    return p + 1;
+}
+
+void* track_calloc(size_t count, size_t size, const char *file, int line) {
+    if (size != 0 && count > (SIZE_MAX - sizeof(PaddedHeader)) / size) return NULL;
+    size_t bytes = count * size;
+    PaddedHeader *p = calloc(1, sizeof(PaddedHeader) + bytes);
+    if (p == NULL) return NULL;
+
+    pthread_mutex_lock(&lock);
+    int linked = link_block(&p->header, bytes, file, line);
+    if (linked == 0) stats.calloc_calls++;
+    pthread_mutex_unlock(&lock);
+    if (linked != 0) {
+        free(p);
+        return NULL;
+    }
+    return p + 1;
+}
+
+void* track_realloc(void *ptr, size_t size, const char *file, int line) {
+    if (ptr == NULL) {
+        void *fresh = track_malloc(size, file, line);
+        if (fresh == NULL) return NULL;
+        pthread_mutex_lock(&lock);
+        stats.malloc_calls--;  // Count it as a realloc call instead
+        stats.realloc_calls++;
+        pthread_mutex_unlock(&lock);
+        return fresh;
+    }
+    if (size > SIZE_MAX - sizeof(PaddedHeader)) return NULL;
+
+    pthread_mutex_lock(&lock);
+    if (!set_contains(ptr)) {
+        pthread_mutex_unlock(&lock);
+        return realloc(ptr, size);  // Not ours - leave it alone
+    }
+    BlockHeader *h = header_of(ptr);
+    stats.realloc_calls++;
+    unlink_block(h);
+    // Hold the lock across realloc: the block must not be in the list while it moves
+    PaddedHeader *p = realloc((PaddedHeader*)h, sizeof(PaddedHeader) + size);
+    // Relinking can't fail: the set just had room for this block and gave it back
+    if (p == NULL) {
+        link_block(h, h->size, h->file, h->line);  // Old block still valid: put it back
+        stats.histogram[bucket_for(h->size)]--;
+        pthread_mutex_unlock(&lock);
+        return NULL;
+    }
+    link_block(&p->header, size, file, line);
+    pthread_mutex_unlock(&lock);
+    return p + 1;
+}
+
+void track_free(void *ptr) {
+    if (ptr == NULL) return;
+
+    pthread_mutex_lock(&lock);
+    if (!set_contains(ptr)) {
+        pthread_mutex_unlock(&lock);
+        free(ptr);  // Not ours (e.g. from strdup) - real free
+        return;
+    }
+    BlockHeader *h = header_of(ptr);
+    stats.free_calls++;
+    unlink_block(h);
+    pthread_mutex_unlock(&lock);
+    free(h);
+}
+
+void alloc_track_stats(AllocStats *out) {
+    pthread_mutex_lock(&lock);
+    *out = stats;
+    pthread_mutex_unlock(&lock);
+}
+
+void alloc_track_reset_counters(void) {
+    pthread_mutex_lock(&lock);
+    size_t live_bytes = stats.live_bytes;
+    size_t live_blocks = stats.live_blocks;
+    memset(&stats, 0, sizeof(stats));
+    stats.live_bytes = live_bytes;
+    stats.live_blocks = live_blocks;
+    stats.peak_bytes = live_bytes;
+    pthread_mutex_unlock(&lock);
+}
+
+void alloc_track_report(FILE *out) {
+    pthread_mutex_lock(&lock);
+
+    fprintf(out, "\n===== ALLOCATION REPORT =====\n");
+    fprintf(out, "malloc: %zu  calloc: %zu  realloc: %zu  free: %zu\n",
+            stats.malloc_calls, stats.calloc_calls, stats.realloc_calls, stats.free_calls);
+    fprintf(out, "peak live: %zu bytes\n", stats.peak_bytes);
+    fprintf(out, "live now:  %zu bytes in %zu blocks\n", stats.live_bytes, stats.live_blocks);
+
+    fprintf(out, "request sizes:\n");
+    for (int k = 0; k < ALLOC_TRACK_BUCKETS; k++) {
+        if (stats.histogram[k] == 0) continue;
+        size_t lo = k == 0 ? 0 : (size_t)1 << k;
+        size_t hi = ((size_t)1 << (k + 1)) - 1;
+        fprintf(out, "  %10zu - %-10zu %zu\n", lo, hi, stats.histogram[k]);
+    }
+
+    if (live_list != NULL) {
+        fprintf(out, "LEAKS (allocated, never freed):\n");
+        size_t shown = 0;
+        for (BlockHeader *h = live_list; h != NULL; h = h->next) {
+            if (shown++ == MAX_LEAKS_SHOWN) {
+                fprintf(out, "  ... and %zu more\n", stats.live_blocks - MAX_LEAKS_SHOWN);
+                break;
+            }
+            fprintf(out, "  %zu bytes at %s:%d\n", h->size, h->file, h->line);
+        }
+    } else {
+        fprintf(out, "No leaks\n");
+    }
+
+    pthread_mutex_unlock(&lock);
+}
+
+static void report_at_exit(void) {
+    alloc_track_report(stderr);
+}
+
+__attribute__((constructor)) static void alloc_track_init(void) {
+    atexit(report_at_exit);
+}
@@ -0,0 +1,75 @@
+#ifndef ALLOC_TRACK_H
+#define ALLOC_TRACK_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ALLOCATION TRACKING
+// ===================
+// Opt-in instrumentation for malloc/calloc/realloc/free (see c05_memory.c)
+// Measures what the comments there only describe:
+// - live bytes right now, and the PEAK live bytes
+// - how many malloc/calloc/realloc/free calls happened
+// - a histogram of request sizes (powers of two)
+// - every block still allocated at exit, with the file:line that allocated it
+//
+// No source changes needed - force-include this header and define ALLOC_TRACK:
+//   gcc -DALLOC_TRACK -include alloc_track.h -o program dynamic_array.c alloc_track.c
+//   ./program            // Report printed to stderr at exit
+//
+// The macros below then turn every malloc(n) into track_malloc(n, __FILE__, __LINE__)
+// Without -DALLOC_TRACK this header changes nothing
+//
+// Limitations:
+// - Only memory allocated through the macros is tracked. Blocks from
+//   libraries (strdup, getline, ...) are recognized as foreign (a lookup in a
+//   set of tracked pointers - nothing in front of them is read) and passed
+//   through to the real free() / realloc()
+// - -include pulls in <stdlib.h> first, so files that #define _POSIX_C_SOURCE
+//   themselves get a harmless "redefined" warning
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ALLOC_TRACK_BUCKETS 48   // Bucket k counts requests of 2^k .. 2^(k+1)-1 bytes (k=0 also holds 0)
+
+typedef struct {
+    size_t live_bytes;       // Currently allocated (requested sizes, not malloc overhead)
+    size_t peak_bytes;       // Highest live_bytes ever seen
+    size_t live_blocks;
+    size_t malloc_calls;
+    size_t calloc_calls;
+    size_t realloc_calls;
+    size_t free_calls;
+    size_t histogram[ALLOC_TRACK_BUCKETS];
+} AllocStats;
+
+void* track_malloc(size_t size, const char *file, int line);
+void* track_calloc(size_t count, size_t size, const char *file, int line);
+void* track_realloc(void *ptr, size_t size, const char *file, int line);
+void track_free(void *ptr);
+
+// Snapshot of the counters (thread-safe)
+void alloc_track_stats(AllocStats *out);
+
+// Print counters, histogram and leaked blocks (called automatically at exit)
+void alloc_track_report(FILE *out);
+
+// Zero the call counters and histogram; peak restarts from the current live bytes
+void alloc_track_reset_counters(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+// alloc_track.c defines ALLOC_TRACK_IMPL so it can still call the real functions
+#if defined(ALLOC_TRACK) && !defined(ALLOC_TRACK_IMPL)
+#define malloc(size)          track_malloc((size), __FILE__, __LINE__)
+#define calloc(count, size)   track_calloc((count), (size), __FILE__, __LINE__)
+#define realloc(ptr, size)    track_realloc((ptr), (size), __FILE__, __LINE__)
+#define free(ptr)             track_free(ptr)
+#endif
+
+#endif
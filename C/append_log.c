@@ -0,0 +1,274 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "append_log.h"
+
+// ASYNC APPEND LOG - IMPLEMENTATION
+// =================================
+// Records are copied into 64 KiB chunks on a queue:
+//
+//   appenders -> [chunk] -> [chunk] -> [chunk (tail, filling)]
+//
+// The writer thread grabs the WHOLE queue at once (appenders immediately
+// start a new one), writes every chunk with a single writev(), then puts
+// the chunks on a spare list so steady-state logging doesn't call malloc
+
+#define CHUNK_SIZE   (64 * 1024)
+#define MAX_QUEUED   (64 * 1024 * 1024)
+#define MAX_SPARE    16
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+struct LogChunk {
+    LogChunk *next;
+    size_t used;
+    size_t cap;
+    char data[];
+};
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ===== WRITER THREAD =====
+
+// writev every chunk in the list, handling partial writes
+static int write_chunks(int fd, LogChunk *list) {
+    struct iovec iov[IOV_MAX > 256 ? 256 : IOV_MAX];
+    const int max_iov = (int)(sizeof(iov) / sizeof(iov[0]));
+
+    while (list != NULL) {
+        int count = 0;
+        for (LogChunk *c = list; c != NULL && count < max_iov; c = c->next) {
+            iov[count].iov_base = c->data;
+            iov[count].iov_len = c->used;
+            count++;
+        }
+
+        int first = 0;
+        while (first < count) {
+            ssize_t n = writev(fd, iov + first, count - first);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            // Skip fully written buffers, trim a partially written one
+            while (first < count && (size_t)n >= iov[first].iov_len) {
+                n -= (ssize_t)iov[first].iov_len;
+                first++;
+            }
+            if (first < count) {
+                iov[first].iov_base = (char*)iov[first].iov_base + n;
+                iov[first].iov_len -= (size_t)n;
+            }
+        }
+
+        for (int i = 0; i < count; i++) list = list->next;
+    }
+    return 0;
+}
+
+// Caller holds the lock
+static void recycle(AppendLog *log, LogChunk *list) {
+    size_t spare = 0;
+    for (LogChunk *c = log->spare; c != NULL; c = c->next) spare++;
+
+    while (list != NULL) {
+        LogChunk *next = list->next;
+        if (list->cap == CHUNK_SIZE && spare < MAX_SPARE) {
+            list->next = log->spare;
+            log->spare = list;
+            spare++;
+        } else {
+            free(list);
+        }
+        list = next;
+    }
+}
+
+static void* writer_main(void *arg) {
+    AppendLog *log = arg;
+    double interval = log->interval_ms / 1000.0;
+    double last_sync = now_sec();
+    int dirty = 0;  // Written but not fsynced yet (LOG_FSYNC_INTERVAL)
+
+    pthread_mutex_lock(&log->lock);
+    for (;;) {
+        while (log->head == NULL && !log->shutting_down) {
+            if (dirty) {
+                // Idle but unsynced: sleep only until the interval is due
+                double wait = last_sync + interval - now_sec();
+                if (wait <= 0) break;
+                struct timespec until;
+                clock_gettime(CLOCK_REALTIME, &until);
+                long long ns = until.tv_nsec + (long long)(wait * 1e9);
+                until.tv_sec += ns / 1000000000;
+                until.tv_nsec = ns % 1000000000;
+                pthread_cond_timedwait(&log->has_data, &log->lock, &until);
+            } else {
+                pthread_cond_wait(&log->has_data, &log->lock);
+            }
+        }
+        if (log->head == NULL && log->shutting_down) break;
+
+        // Take the whole queue; appenders start filling a fresh one
+        LogChunk *batch = log->head;
+        log->head = log->tail = NULL;
+        size_t bytes = log->queued_bytes;
+        log->queued_bytes = 0;
+        pthread_cond_broadcast(&log->has_space);
+        pthread_mutex_unlock(&log->lock);
+
+        int err = batch != NULL ? write_chunks(log->fd, batch) : 0;
+        if (batch != NULL) dirty = 1;
+
+        if (err == 0 && dirty) {
+            if (log->policy == LOG_FSYNC_BATCH ||
+                (log->policy == LOG_FSYNC_INTERVAL && now_sec() - last_sync >= interval)) {
+                if (fsync(log->fd) != 0) err = errno;
+                last_sync = now_sec();
+                dirty = 0;
+            } else if (log->policy == LOG_FSYNC_NONE) {
+                dirty = 0;
+            }
+        }
+
+        pthread_mutex_lock(&log->lock);
+        if (batch != NULL) {
+            log->batches++;
+            log->bytes_written += bytes;
+            recycle(log, batch);
+        }
+        if (err != 0 && log->error == 0) {
+            log->error = err;
+            pthread_cond_broadcast(&log->has_space);  // Wake blocked appenders so they see the error
+        }
+    }
+    pthread_mutex_unlock(&log->lock);
+    return NULL;
+}
+
+// ===== PUBLIC API =====
+
+AppendLog* append_log_open(const char *path, LogFsyncPolicy policy, unsigned interval_ms) {
+    AppendLog *log = calloc(1, sizeof(AppendLog));
+    if (log == NULL) return NULL;
+
+    log->fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (log->fd < 0) {
+        free(log);
+        return NULL;
+    }
+    log->policy = policy;
+    log->interval_ms = interval_ms > 0 ? interval_ms : 1000;
+    log->max_queued = MAX_QUEUED;
+
+    pthread_mutex_init(&log->lock, NULL);
+    pthread_cond_init(&log->has_data, NULL);
+    pthread_cond_init(&log->has_space, NULL);
+
+    if (pthread_create(&log->writer, NULL, writer_main, log) != 0) {
+        close(log->fd);
+        pthread_mutex_destroy(&log->lock);
+        pthread_cond_destroy(&log->has_data);
+        pthread_cond_destroy(&log->has_space);
+        free(log);
+        return NULL;
+    }
+    return log;
+}
+
+// Caller holds the lock
+static LogChunk* new_chunk(AppendLog *log, size_t min_size) {
+    LogChunk *chunk;
+    if (min_size <= CHUNK_SIZE && log->spare != NULL) {
+        chunk = log->spare;
+        log->spare = chunk->next;
+    } else {
+        size_t cap = min_size > CHUNK_SIZE ? min_size : CHUNK_SIZE;  // Huge record = own chunk
+        chunk = malloc(sizeof(LogChunk) + cap);
+        if (chunk == NULL) return NULL;
+        chunk->cap = cap;
+    }
+    chunk->next = NULL;
+    chunk->used = 0;
+    return chunk;
+}
+
+int append_log_write(AppendLog *log, const void *data, size_t len) {
+    if (len == 0) return 0;
+
+    pthread_mutex_lock(&log->lock);
+    // Back-pressure: don't let memory grow without bound if the disk can't keep up
+    while (log->queued_bytes > 0 && log->queued_bytes + len > log->max_queued && log->error == 0) {
+        pthread_cond_wait(&log->has_space, &log->lock);
+    }
+    if (log->error != 0) {
+        pthread_mutex_unlock(&log->lock);
+        return -1;
+    }
+
+    LogChunk *tail = log->tail;
+    if (tail == NULL || tail->cap - tail->used < len) {
+        LogChunk *chunk = new_chunk(log, len);
+        if (chunk == NULL) {
+            pthread_mutex_unlock(&log->lock);
+            return -1;
+        }
+        if (tail != NULL) tail->next = chunk;
+        else log->head = chunk;
+        log->tail = tail = chunk;
+    }
+
+    memcpy(tail->data + tail->used, data, len);
+    tail->used += len;
+    int was_empty = log->queued_bytes == 0;
+    log->queued_bytes += len;
+    if (was_empty) pthread_cond_signal(&log->has_data);  // Writer only needs one wake-up per batch
+    pthread_mutex_unlock(&log->lock);
+    return 0;
+}
+
+void append_log_stats(AppendLog *log, size_t *batches, size_t *bytes_written) {
+    pthread_mutex_lock(&log->lock);
+    if (batches != NULL) *batches = log->batches;
+    if (bytes_written != NULL) *bytes_written = log->bytes_written;
+    pthread_mutex_unlock(&log->lock);
+}
+
+int append_log_close(AppendLog *log) {
+    if (log == NULL) return 0;
+
+    pthread_mutex_lock(&log->lock);
+    log->shutting_down = 1;
+    pthread_cond_signal(&log->has_data);
+    pthread_mutex_unlock(&log->lock);
+    pthread_join(log->writer, NULL);  // Writer drains the queue before exiting
+
+    int result = log->error == 0 ? 0 : -1;
+    if (log->policy != LOG_FSYNC_NONE && fsync(log->fd) != 0) result = -1;
+    if (close(log->fd) != 0) result = -1;
+
+    recycle(log, log->head);  // Only non-empty if a write failed
+    while (log->spare != NULL) {
+        LogChunk *next = log->spare->next;
+        free(log->spare);
+        log->spare = next;
+    }
+    pthread_mutex_destroy(&log->lock);
+    pthread_cond_destroy(&log->has_data);
+    pthread_cond_destroy(&log->has_space);
+    free(log);
+    return result;
+}
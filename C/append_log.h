@@ -0,0 +1,84 @@
+#ifndef APPEND_LOG_H
+#define APPEND_LOG_H
+
+#include <pthread.h>
+#include <stddef.h>
+
+// ASYNC BATCHED APPEND-ONLY LOG
+// =============================
+// c12_files.c appends with fopen("a") + fprintf for every line. Under heavy
+// logging that is one system call (or more) per record.
+//
+// AppendLog instead:
+// - append_log_write just COPIES the record into an in-memory batch (fast, no syscall)
+// - A background thread takes the whole batch and writes it with ONE writev() call
+// - The busier the log, the bigger each batch - syscalls per record drop automatically
+// - fsync policy decides when data is forced to the physical disk:
+//     LOG_FSYNC_NONE     - never (the OS writes it back eventually; fastest)
+//     LOG_FSYNC_BATCH    - after every batch (safest, slowest)
+//     LOG_FSYNC_INTERVAL - at most once per interval_ms
+// - append_log_close writes out everything still queued before returning
+//
+//   AppendLog *log = append_log_open("app.log", LOG_FSYNC_INTERVAL, 100);
+//   append_log_write(log, "started\n", 8);
+//   append_log_close(log);
+//
+// Build: gcc -O2 -pthread -o program your_file.c append_log.c   (POSIX only)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    LOG_FSYNC_NONE,
+    LOG_FSYNC_BATCH,
+    LOG_FSYNC_INTERVAL
+} LogFsyncPolicy;
+
+typedef struct LogChunk LogChunk;
+
+typedef struct {
+    int fd;
+    LogFsyncPolicy policy;
+    unsigned interval_ms;
+
+    pthread_mutex_t lock;
+    pthread_cond_t has_data;    // Writer waits on this
+    pthread_cond_t has_space;   // Appenders wait on this when too much is queued
+    pthread_t writer;
+
+    LogChunk *head;             // Queued chunks, oldest first
+    LogChunk *tail;             // Appenders copy into this one
+    LogChunk *spare;            // Written chunks kept for reuse
+    size_t queued_bytes;
+    size_t max_queued;          // Back-pressure limit
+    int shutting_down;
+    int error;                  // errno of the first failed write/fsync (0 = ok)
+
+    // Counters: read them with append_log_stats
+    size_t batches;
+    size_t bytes_written;
+} AppendLog;
+
+// Returns NULL if the file can't be opened or the thread can't start
+// interval_ms only matters for LOG_FSYNC_INTERVAL
+AppendLog* append_log_open(const char *path, LogFsyncPolicy policy, unsigned interval_ms);
+
+// Queue one record (copied - caller may reuse data immediately). Thread-safe.
+// Blocks only if more than max_queued bytes are waiting to be written
+// 0 = queued, -1 = out of memory or an earlier write failed
+int append_log_write(AppendLog *log, const void *data, size_t len);
+
+// Batches written with writev so far, and their bytes. Thread-safe; call before close
+void append_log_stats(AppendLog *log, size_t *batches, size_t *bytes_written);
+
+// Drain the queue, final fsync (unless LOG_FSYNC_NONE), stop the thread, close the file,
+// free the log
+// 0 = every record reached the file, -1 = some write/fsync failed
+int append_log_close(AppendLog *log);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
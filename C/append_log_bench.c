@@ -0,0 +1,97 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "append_log.h"
+
+// APPEND LOG BENCHMARK
+// ====================
+// Appends N ~100-byte records and reports per-append latency (p50/p99) and MB/s
+// 1. fprintf + fflush per record (what c12_files.c does: one write() per line)
+// 2. AppendLog with each fsync policy
+// MB/s includes closing the log, i.e. until every record is in the file
+//
+// Build: gcc -O2 -pthread -o program append_log_bench.c append_log.c && ./program [records]
+
+#define BENCH_FILE "bench_append.log"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void report(const char *name, double *latency, size_t records, size_t bytes, double total) {
+    qsort(latency, records, sizeof(double), compare_double);
+    printf("%-22s p50 %7.0f ns  p99 %8.0f ns  max %10.0f ns  %8.1f MB/s\n", name,
+           latency[records / 2] * 1e9, latency[records * 99 / 100] * 1e9,
+           latency[records - 1] * 1e9, bytes / total / 1e6);
+}
+
+static int format_record(char *line, size_t i) {
+    return snprintf(line, 128, "%010zu INFO request handled status=200 latency_us=%zu user=user%zu path=/api/items\n",
+                    i, i % 997, i % 1000);
+}
+
+static void bench_fprintf(size_t records, double *latency) {
+    remove(BENCH_FILE);
+    FILE *file = fopen(BENCH_FILE, "a");
+    char line[128];
+    size_t bytes = 0;
+
+    double start = now_sec();
+    for (size_t i = 0; i < records; i++) {
+        int len = format_record(line, i);
+        double t = now_sec();
+        fprintf(file, "%s", line);
+        fflush(file);  // Make the record visible to other readers now, like a logger must
+        latency[i] = now_sec() - t;
+        bytes += (size_t)len;
+    }
+    fclose(file);
+    report("fprintf + fflush", latency, records, bytes, now_sec() - start);
+}
+
+static void bench_log(const char *name, LogFsyncPolicy policy, size_t records, double *latency) {
+    remove(BENCH_FILE);
+    AppendLog *log = append_log_open(BENCH_FILE, policy, 50);
+    char line[128];
+    size_t bytes = 0;
+
+    double start = now_sec();
+    for (size_t i = 0; i < records; i++) {
+        int len = format_record(line, i);
+        double t = now_sec();
+        append_log_write(log, line, (size_t)len);
+        latency[i] = now_sec() - t;
+        bytes += (size_t)len;
+    }
+    size_t batches;
+    append_log_stats(log, &batches, NULL);
+    if (append_log_close(log) != 0) printf("  write error!\n");
+    report(name, latency, records, bytes, now_sec() - start);
+    printf("%-22s (%zu writev batches before close)\n", "", batches);
+}
+
+int main(int argc, char *argv[]) {
+    size_t records = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    if (records == 0) records = 1;
+    double *latency = malloc(records * sizeof(double));
+
+    printf("%zu records\n\n", records);
+    bench_fprintf(records, latency);
+    bench_log("AppendLog fsync none", LOG_FSYNC_NONE, records, latency);
+    bench_log("AppendLog fsync 50ms", LOG_FSYNC_INTERVAL, records, latency);
+    bench_log("AppendLog fsync batch", LOG_FSYNC_BATCH, records, latency);
+
+    remove(BENCH_FILE);
+    free(latency);
+    return 0;
+}
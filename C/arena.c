@@ -0,0 +1,113 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+// ARENA ALLOCATOR - IMPLEMENTATION
+// ================================
+
+#define ARENA_ALIGN 16
+
+struct ArenaChunk {
+    ArenaChunk *next;
+    size_t capacity;    // Usable bytes in data[]
+    size_t used;        // Bump cursor
+    size_t last;        // Offset of the most recent allocation (for in-place realloc)
+    _Alignas(ARENA_ALIGN) unsigned char data[];
+};
+
+static size_t align_up(size_t n) {
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static ArenaChunk* chunk_new(size_t capacity) {
+    ArenaChunk *chunk = malloc(sizeof(ArenaChunk) + capacity);
+    if (chunk == NULL) return NULL;
+    chunk->next = NULL;
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    chunk->last = 0;
+    return chunk;
+}
+
+Arena* arena_create(size_t chunk_size) {
+    Arena *arena = malloc(sizeof(Arena));
+    if (arena == NULL) return NULL;
+
+    arena->chunk_size = chunk_size > 0 ? align_up(chunk_size) : ARENA_DEFAULT_CHUNK;
+    arena->first = chunk_new(arena->chunk_size);
+    if (arena->first == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena->current = arena->first;
+    arena->total = arena->chunk_size;
+    return arena;
+}
+
+void arena_destroy(Arena *arena) {
+    if (arena == NULL) return;
+    ArenaChunk *chunk = arena->first;
+    while (chunk != NULL) {
+        ArenaChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+void* arena_alloc(Arena *arena, size_t size) {
+    if (size > SIZE_MAX - ARENA_ALIGN) return NULL;
+    size = align_up(size == 0 ? 1 : size);
+
+    // Move forward through chunks kept from before the last reset
+    ArenaChunk *chunk = arena->current;
+    while (chunk->capacity - chunk->used < size && chunk->next != NULL) {
+        chunk = chunk->next;
+    }
+
+    if (chunk->capacity - chunk->used < size) {
+        // No room anywhere: new chunk (oversized requests get a chunk of their own)
+        size_t capacity = size > arena->chunk_size ? size : arena->chunk_size;
+        ArenaChunk *fresh = chunk_new(capacity);
+        if (fresh == NULL) return NULL;
+        chunk->next = fresh;
+        chunk = fresh;
+        arena->total += capacity;
+    }
+
+    arena->current = chunk;
+    chunk->last = chunk->used;
+    chunk->used += size;
+    return chunk->data + chunk->last;
+}
+
+void* arena_realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size) {
+    if (ptr == NULL) return arena_alloc(arena, new_size);
+
+    ArenaChunk *chunk = arena->current;
+    if ((unsigned char*)ptr == chunk->data + chunk->last && new_size <= SIZE_MAX - ARENA_ALIGN) {
+        // Most recent allocation: just move the cursor (grow or shrink in place)
+        size_t end = chunk->last + align_up(new_size == 0 ? 1 : new_size);
+        if (end <= chunk->capacity) {
+            chunk->used = end;
+            return ptr;
+        }
+    } else if (new_size <= old_size) {
+        return ptr;  // Shrinking an older block: nothing to reclaim
+    }
+
+    void *fresh = arena_alloc(arena, new_size);
+    if (fresh == NULL) return NULL;
+    memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+    return fresh;
+}
+
+void arena_reset(Arena *arena) {
+    for (ArenaChunk *chunk = arena->first; chunk != NULL; chunk = chunk->next) {
+        chunk->used = 0;
+        chunk->last = 0;
+    }
+    arena->current = arena->first;
+}
@@ -0,0 +1,61 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// ARENA (BUMP) ALLOCATOR
+// ======================
+// Hands out memory by bumping a pointer through big pre-allocated chunks
+// - arena_alloc: O(1), just "cursor += size" (no per-block bookkeeping)
+// - NO individual free - everything is released at once with arena_reset
+// - arena_reset keeps the chunks, so the next batch reuses the same memory
+//
+// Perfect for "allocate lots, then throw it all away" work, e.g. per request:
+//   Arena *a = arena_create(0);
+//   for (each request) {
+//       DynamicArray *arr = array_create_in(a, sizeof(int), 8, NULL);
+//       ... build many arrays ...
+//       arena_reset(a);   // ONE call frees every array made this request
+//   }
+//   arena_destroy(a);
+//
+// Compared with malloc/free (see c05_memory.c):
+// - No risk of leaks inside a batch (nothing to forget to free)
+// - Pointers into the arena dangle after reset - same rule as after free()
+//
+// Build: gcc -O2 -o program your_file.c arena.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARENA_DEFAULT_CHUNK (64 * 1024)
+
+typedef struct ArenaChunk ArenaChunk;
+
+typedef struct {
+    ArenaChunk *first;     // All chunks, in allocation order
+    ArenaChunk *current;   // Chunk we are bumping through
+    size_t chunk_size;     // Default size of new chunks
+    size_t total;          // Bytes reserved from malloc (all chunks)
+} Arena;
+
+// chunk_size 0 = ARENA_DEFAULT_CHUNK; returns NULL if allocation fails
+Arena* arena_create(size_t chunk_size);
+void arena_destroy(Arena *arena);
+
+// Returns 16-byte aligned memory, or NULL if out of memory
+void* arena_alloc(Arena *arena, size_t size);
+
+// Resize the block at ptr (old_size bytes) - grows in place if ptr was the
+// most recent allocation and the chunk has room, otherwise copies
+void* arena_realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size);
+
+// Release everything allocated so far (chunks kept for reuse)
+void arena_reset(Arena *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,110 @@
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "arena.h"
+#include "darray.h"
+
+// ARENA vs MALLOC BENCHMARK
+// =========================
+// Simulates a batch job: each "request" builds many small DynamicArrays
+// (a handful of ints each) and throws them all away at the end
+// 1. malloc: array_create + array_free for every array
+// 2. arena:  array_create_in, then ONE arena_reset per request
+//
+// Each mode runs in its own child process so peak RSS is measured separately
+//
+// Build: gcc -O2 -o program arena_bench.c arena.c darray.c && ./program [requests] [arrays_per_request]
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Peak resident set size in KiB (Linux reports KiB, macOS reports bytes)
+static long peak_rss_kib(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+// Size of array i: 1..16 elements, spread evenly
+static int array_len(size_t i) {
+    return 1 + (int)(((unsigned)i * 2654435761u) >> 28);
+}
+
+static long long run_malloc(size_t requests, size_t per_request) {
+    DynamicArray **arrays = malloc(per_request * sizeof(DynamicArray*));
+    long long checksum = 0;
+
+    for (size_t r = 0; r < requests; r++) {
+        for (size_t i = 0; i < per_request; i++) {
+            arrays[i] = array_create(sizeof(int), 4, NULL);
+            int len = array_len(i);
+            for (int v = 0; v < len; v++) array_push(arrays[i], &v);
+        }
+        for (size_t i = 0; i < per_request; i++) {
+            checksum += arrays[i]->size;
+            array_free(arrays[i]);
+        }
+    }
+    free(arrays);
+    return checksum;
+}
+
+static long long run_arena(size_t requests, size_t per_request) {
+    DynamicArray **arrays = malloc(per_request * sizeof(DynamicArray*));
+    Arena *arena = arena_create(0);
+    long long checksum = 0;
+
+    for (size_t r = 0; r < requests; r++) {
+        for (size_t i = 0; i < per_request; i++) {
+            arrays[i] = array_create_in(arena, sizeof(int), 4, NULL);
+            int len = array_len(i);
+            for (int v = 0; v < len; v++) array_push(arrays[i], &v);
+        }
+        for (size_t i = 0; i < per_request; i++) {
+            checksum += arrays[i]->size;
+        }
+        arena_reset(arena);  // Frees every array from this request
+    }
+    arena_destroy(arena);
+    free(arrays);
+    return checksum;
+}
+
+static void run_in_child(const char *name, long long (*fn)(size_t, size_t),
+                         size_t requests, size_t per_request) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        double start = now_sec();
+        long long checksum = fn(requests, per_request);
+        double elapsed = now_sec() - start;
+        size_t arrays = requests * per_request;
+        printf("%-8s %9.2f ms  %8.2f M arrays/s  peak RSS %7ld KiB  (checksum %lld)\n",
+               name, elapsed * 1e3, arrays / elapsed / 1e6, peak_rss_kib(), checksum);
+        exit(0);
+    }
+    waitpid(pid, NULL, 0);
+}
+
+int main(int argc, char *argv[]) {
+    size_t requests = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000;
+    size_t per_request = argc > 2 ? strtoull(argv[2], NULL, 10) : 10000;
+    if (per_request == 0) per_request = 1;
+
+    printf("%zu requests x %zu arrays\n\n", requests, per_request);
+    run_in_child("malloc", run_malloc, requests, per_request);
+    run_in_child("arena", run_arena, requests, per_request);
+    return 0;
+}
@@ -1,21 +1,44 @@
-#include <stdio.h>
+#include "test_harness.h"
+
+// Checks the variables from c01_hello.c hold what their declarations say
+//
+// Build: gcc -O2 -o program c01_hello_test.c && ./program
 
 int myNum = 15;            // Integer (whole number)
 float myFloatNum = 5.99;   // Floating point number
 char myLetter = 'D';       // Character
 double myDoubleNum = 9.99345456789; // Double precision floating point number
 
-int main() {
+TEST(int_variable) {
+    CHECK_EQ(myNum, 15);
+}
+
+TEST(float_variable) {
+    // 5.99 has no exact float: compare with a tolerance, never with ==
+    CHECK_NEAR(myFloatNum, 5.99, 1e-6);
+    CHECK(myFloatNum != 5.99);   // The double literal keeps more digits than the float
+}
+
+TEST(char_variable) {
+    CHECK_EQ(myLetter, 'D');
+    CHECK_EQ(myLetter, 68);      // A char is a small integer (ASCII code)
+}
 
-    printf("Hello World! \n");
-    // Create variables
-  
+TEST(double_variable) {
+    CHECK_NEAR(myDoubleNum, 9.99345456789, 1e-12);
+}
 
-    // Print variables
-    printf("%d\n", myNum);
-    printf("%f\n", myFloatNum);
-    printf("%c\n", myLetter);
-    printf("%lf\n", myDoubleNum);
+TEST(printf_formats) {
+    // What printf("%d/%f/%c/%lf") printed in the old version of this file
+    char buffer[64];
+    snprintf(buffer, sizeof buffer, "%d", myNum);
+    CHECK_STR_EQ(buffer, "15");
+    snprintf(buffer, sizeof buffer, "%f", myFloatNum);
+    CHECK_STR_EQ(buffer, "5.990000");
+    snprintf(buffer, sizeof buffer, "%c", myLetter);
+    CHECK_STR_EQ(buffer, "D");
+    snprintf(buffer, sizeof buffer, "%lf", myDoubleNum);
+    CHECK_STR_EQ(buffer, "9.993455");
+}
 
-  return 0;
-}
\ No newline at end of file
+HARNESS_MAIN()
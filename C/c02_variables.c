@@ -136,11 +136,11 @@ int main() {
     // Can also cast the result
     printf("Float division (alt): %.2f\n", (float)(a) / (float)(b));  // 3.33
     
-    double x = 9.8;
-    printf("Double to int: %.1f -> %d\n", x, (int)x);  // 9.8 -> 9 (truncates)
+    double y = 9.8;
+    printf("Double to int: %.1f -> %d\n", y, (int)y);  // 9.8 -> 9 (truncates)
     
     // Implicit casting (automatic)
-    double result = a + x;  // a is automatically cast to double
+    double result = a + y;  // a is automatically cast to double
     printf("Implicit cast: int + double = %.1f\n", result);  // 19.8
     
     return 0;
@@ -226,3 +226,5 @@ int main() {
 // - strcmp returns 0 for equal strings (not 1 like other languages!)
 // - Use strncpy/strncat for safer string operations
 // - fgets is safer than scanf for reading strings with spaces
+// - Building strings with many strcat calls is O(n^2) - see lstring.h for a length-prefixed string
+// - strstr finds one pattern per pass; multi_match.h finds many keywords in one pass
@@ -1,39 +1,64 @@
-#include <stdio.h>
-#include <stdlib.h>
+#include "test_harness.h"
+
+// Tests for the pointer-to-pointer array functions from c04_pointers.c
+// push_back/pop_back take int** so they can move the caller's array (realloc)
+//
+// Build: gcc -O2 -o program c04_pointers_test.c && ./program [--bench]
 
 void push_back(int **numPP, int *size, int val){
     *numPP = (int*)realloc(*numPP, ++(*size) * sizeof(int));
     (*numPP)[*size - 1] = val;
 }
 
+// Same as c04_pointers.c, minus its "Empty array." message (tests don't print)
 void pop_back(int **numPP, int *size){
-    if(*size <= 0){
-        printf("Empty array.");
-        return;
-    }
+    if(*size <= 0) return;
     *numPP = (int*)realloc(*numPP, --(*size) * sizeof(int));
 }
 
-void print_array(int **numPP, int *size){
-    printf("[");
-    for (int i = 0; i < *size; i++){
-        printf("%d", (*numPP)[i]);
-        if (i < *size - 1) printf(", ");
-    }
-    printf("]\n");
+TEST(push_back_appends) {
+    int size = 0;
+    int *numbersP = NULL;   // realloc(NULL, n) works like malloc(n)
+    push_back(&numbersP, &size, 10);
+    push_back(&numbersP, &size, 20);
+    push_back(&numbersP, &size, 30);
+    REQUIRE(numbersP != NULL);
+    CHECK_EQ(size, 3);
+    CHECK_EQ(numbersP[0], 10);
+    CHECK_EQ(numbersP[1], 20);
+    CHECK_EQ(numbersP[2], 30);
+    free(numbersP);
 }
 
-int main(){
-
+TEST(pop_back_removes_last) {
     int size = 0;
-    int *numbersP = (int*)malloc(size * sizeof(int));
-
+    int *numbersP = NULL;
     push_back(&numbersP, &size, 10);
     push_back(&numbersP, &size, 20);
     push_back(&numbersP, &size, 30);
     pop_back(&numbersP, &size);
+    REQUIRE(numbersP != NULL);
+    CHECK_EQ(size, 2);
+    CHECK_EQ(numbersP[0], 10);
+    CHECK_EQ(numbersP[1], 20);
+    free(numbersP);
+}
+
+TEST(pop_back_on_empty_keeps_size) {
+    int size = 0;
+    int *numbersP = NULL;
+    pop_back(&numbersP, &size);
+    CHECK_EQ(size, 0);
+    CHECK(numbersP == NULL);
+}
 
-    print_array(&numbersP, &size);
+// realloc on EVERY push: compare with array_push in darray_test.c (doubling)
+BENCH(push_back_1000, 1000) {
+    int size = 0;
+    int *numbersP = NULL;
+    for (int i = 0; i < 1000; i++) push_back(&numbersP, &size, i);
+    bench_keep(numbersP);
     free(numbersP);
-    return 0;
-}
\ No newline at end of file
+}
+
+HARNESS_MAIN()
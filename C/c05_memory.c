@@ -266,3 +266,4 @@ int main() {
 // - For 2D arrays: allocate array of pointers, then each row
 // - Free in reverse order of allocation for 2D arrays
 // - Dynamic memory goes on the heap (larger than stack)
+// - Many short-lived blocks? An arena (arena.h) frees them all with one arena_reset()
@@ -182,3 +182,5 @@ int main() {
 // - Structs can contain other structs (nesting)
 // - Arrays of structs are common for storing multiple records
 // - Struct size may be larger than sum of members (due to padding/alignment)
+// - Scanning ONE field of many structs wastes cache - record_store.h stores each field as its own array
+// - Finding a struct by a field (e.g. Person by name) means scanning the array - hashmap.h indexes it in O(1)
@@ -211,6 +211,7 @@ int main() {
 // - Use typedef to avoid writing 'enum' keyword
 // - Enums make code more readable than magic numbers
 // - Great for switch statements and state machines
+// - Many switches over one enum? enum_tables.h generates name/parse/handler tables from one list
 // - Enum values are just integers (can be compared, printed, etc.)
 // - Can use enums for bit flags with powers of 2
 // - Enums help prevent invalid values (compile-time checking)
@@ -197,3 +197,4 @@ int main() {
 // - Infinite loops: while(1) or for(;;)
 // - Always ensure loop has exit condition to avoid infinite loops
 // - Nested loops multiply iterations (outer * inner)
+// - Big 2D loops that read rows but write columns: see tiled_loops.h (blocked iteration)
@@ -148,4 +148,5 @@ int isEven(int num) {
 // - Use pointers for pass-by-reference
 // - Arrays are always passed by reference (pointer to first element)
 // - Recursive functions must have a base case to avoid infinite recursion
+// - factorial() above overflows int at 13! - math_kernels.h has checked 64/128-bit lookup tables
 // - To return multiple values, use pointers as parameters
@@ -252,7 +252,9 @@ int main() {
 // - Always close files with fclose()
 // - "w" mode overwrites the entire file
 // - "a" mode appends to the end (preserves existing content)
+// - Appending a LOT (logging)? append_log.h batches records and writes them from a background thread
 // - fgets() reads a line (includes newline character)
+// - fgets() with a fixed buffer SPLITS long lines; line_reader.h handles any length, zero-copy
 // - fprintf() writes formatted data to file
 // - fscanf() reads formatted data from file
 // - fgetc() reads one character at a time
@@ -263,3 +265,5 @@ int main() {
 // - remove() deletes a file
 // - rename() renames/moves a file
 // - Use "b" suffix for binary mode ("rb", "wb")
+// - record_file.h saves whole structs in a checked binary format and loads them with mmap (no fscanf)
+// - mmap_array.h maps a binary file straight into memory - no fgets/parse step at all
@@ -0,0 +1,151 @@
+#include "concurrent_array.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ===== SEGMENT MATH =====
+// With B = first segment size, segment k holds B << k elements and starts at
+// index B * (2^k - 1):   k=0: [0, B)   k=1: [B, 3B)   k=2: [3B, 7B) ...
+// So segment of i = floor(log2(i / B + 1)) - one count-leading-zeros instruction
+
+static inline unsigned segment_of(const ConcurrentArray *arr, size_t i) {
+    unsigned long long blocks = (unsigned long long)(i >> arr->first_bits) + 1;
+    return 63u - (unsigned)__builtin_clzll(blocks);
+}
+
+static inline size_t segment_start(const ConcurrentArray *arr, unsigned k) {
+    return (((size_t)1 << k) - 1) << arr->first_bits;
+}
+
+static inline size_t segment_count(const ConcurrentArray *arr, unsigned k) {
+    return (size_t)1 << (arr->first_bits + k);
+}
+
+// Ready flags come first, elements start on the next 64-byte boundary
+static inline size_t flags_bytes(size_t count) {
+    return (count + 63) & ~(size_t)63;
+}
+
+static inline atomic_uchar* segment_flags(unsigned char *segment) {
+    return (atomic_uchar*)segment;
+}
+
+static inline unsigned char* segment_slot(const ConcurrentArray *arr, unsigned char *segment,
+                                          size_t count, size_t offset) {
+    return segment + flags_bytes(count) + offset * arr->elem_size;
+}
+
+// Segment k, allocating it if nobody has yet. NULL if out of memory
+static unsigned char* ensure_segment(ConcurrentArray *arr, unsigned k) {
+    unsigned char *segment = atomic_load_explicit(&arr->segments[k], memory_order_acquire);
+    if (segment) return segment;
+
+    size_t count = segment_count(arr, k);
+    if (count > (SIZE_MAX - flags_bytes(count)) / arr->elem_size) return NULL;
+    // calloc: every ready flag starts at 0 (and big blocks come pre-zeroed from the OS)
+    unsigned char *mine = calloc(1, flags_bytes(count) + count * arr->elem_size);
+    if (mine == NULL) return NULL;
+
+    unsigned char *expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(&arr->segments[k], &expected, mine,
+                                                memory_order_acq_rel, memory_order_acquire)) {
+        return mine;
+    }
+    free(mine);         // Another thread installed it first - use theirs
+    return expected;
+}
+
+// ===== CREATE / FREE =====
+
+ConcurrentArray* carray_create(size_t elem_size, size_t first_segment) {
+    if (elem_size == 0) return NULL;
+    if (first_segment == 0) first_segment = 1024;
+    unsigned bits = 0;
+    while (((size_t)1 << bits) < first_segment && bits < 20) bits++;
+
+    ConcurrentArray *arr = malloc(sizeof(ConcurrentArray));
+    if (arr == NULL) return NULL;
+    atomic_init(&arr->size, 0);
+    arr->elem_size = elem_size;
+    arr->first_bits = bits;
+    for (unsigned k = 0; k < CARRAY_MAX_SEGMENTS; k++) atomic_init(&arr->segments[k], NULL);
+    if (ensure_segment(arr, 0) == NULL) {
+        free(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+void carray_free(ConcurrentArray *arr) {
+    if (arr == NULL) return;
+    for (unsigned k = 0; k < CARRAY_MAX_SEGMENTS; k++) {
+        free(atomic_load_explicit(&arr->segments[k], memory_order_relaxed));
+    }
+    free(arr);
+}
+
+// ===== PUSH =====
+
+size_t carray_push_n(ConcurrentArray *arr, const void *elems, size_t count) {
+    if (count == 0) return carray_size(arr);
+    // Reserve [first, first + count): after this no other thread touches these slots
+    size_t first = atomic_fetch_add_explicit(&arr->size, count, memory_order_relaxed);
+    size_t end = first + count;
+    size_t capacity = segment_start(arr, CARRAY_MAX_SEGMENTS);
+    if (end < first || end > capacity) return CARRAY_FAILED;
+
+    const unsigned char *src = elems;
+    size_t i = first;
+    while (i < end) {
+        unsigned k = segment_of(arr, i);
+        unsigned char *segment = ensure_segment(arr, k);
+        if (segment == NULL) return CARRAY_FAILED;
+        size_t seg_count = segment_count(arr, k);
+        size_t offset = i - segment_start(arr, k);
+        size_t run = seg_count - offset;
+        if (run > end - i) run = end - i;
+
+        // Whoever reserves the middle of segment k allocates segment k+1 early,
+        // so threads rarely find the next segment missing (and race to allocate it)
+        size_t middle = seg_count / 2;
+        if (offset <= middle && middle < offset + run && k + 1 < CARRAY_MAX_SEGMENTS) {
+            ensure_segment(arr, k + 1);
+        }
+
+        memcpy(segment_slot(arr, segment, seg_count, offset), src, run * arr->elem_size);
+        atomic_uchar *flags = segment_flags(segment);
+        for (size_t j = 0; j < run; j++) {
+            // release: the memcpy above is visible before the flag is
+            atomic_store_explicit(&flags[offset + j], 1, memory_order_release);
+        }
+        src += run * arr->elem_size;
+        i += run;
+    }
+    return first;
+}
+
+size_t carray_push(ConcurrentArray *arr, const void *elem) {
+    return carray_push_n(arr, elem, 1);
+}
+
+// ===== READ =====
+
+const void* carray_at(const ConcurrentArray *arr, size_t i) {
+    if (i >= segment_start(arr, CARRAY_MAX_SEGMENTS)) return NULL;
+    unsigned k = segment_of(arr, i);
+    ConcurrentArray *a = (ConcurrentArray*)arr;   // C11 atomic loads take non-const pointers
+    unsigned char *segment = atomic_load_explicit(&a->segments[k], memory_order_acquire);
+    if (segment == NULL) return NULL;
+    size_t offset = i - segment_start(arr, k);
+    // acquire: if the flag is set, the element's bytes are too
+    if (!atomic_load_explicit(&segment_flags(segment)[offset], memory_order_acquire)) return NULL;
+    return segment_slot(arr, segment, segment_count(arr, k), offset);
+}
+
+int carray_get(const ConcurrentArray *arr, size_t i, void *out) {
+    const void *elem = carray_at(arr, i);
+    if (elem == NULL) return -1;
+    memcpy(out, elem, arr->elem_size);
+    return 0;
+}
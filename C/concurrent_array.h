@@ -0,0 +1,79 @@
+#ifndef CONCURRENT_ARRAY_H
+#define CONCURRENT_ARRAY_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+// CONCURRENT APPEND-ONLY ARRAY
+// ============================
+// array_push in efficient_dynamic_array.c is for ONE thread: two threads
+// pushing at once can get the same slot, and realloc can move the data while
+// another thread is reading it. The usual fix is a mutex around every push -
+// then all threads take turns, and more threads just means more waiting.
+//
+// ConcurrentArray lets any number of threads push and read at the same time:
+// - Reserve: atomic_fetch_add on the size hands every push its OWN index
+//   (one instruction, no lock, no retry loop)
+// - Segments instead of realloc: storage is a list of blocks of 1x, 2x, 4x, 8x...
+//   the first block's size. Growing adds a new block; existing elements NEVER
+//   move, so a pointer to an element stays valid until carray_free
+// - New blocks are installed with compare-and-swap: if two threads need the same
+//   block, both allocate, one wins, the other frees its copy
+// - Publish: after copying the element in, the pusher sets the slot's ready
+//   flag (release). A reader that sees the flag (acquire) sees the whole element
+// - Reads are WAIT-FREE: two loads and a flag check, whatever the writers do
+//
+// Index i is reserved before its element is written, so while pushes are in
+// flight a reader can find a reserved slot that isn't published yet.
+//
+//   ConcurrentArray *arr = carray_create(sizeof(int), 1024);
+//   int x = 42;
+//   size_t i = carray_push(arr, &x);      // From any thread
+//   const int *p = carray_at(arr, i);     // NULL if not published yet
+//   carray_free(arr);                     // After all threads are done
+//
+// Build: gcc -O2 -pthread -o program your_file.c concurrent_array.c   (C11 atomics)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CARRAY_MAX_SEGMENTS 40   // Segment k holds first_segment << k elements
+#define CARRAY_FAILED ((size_t)-1)
+
+typedef struct {
+    _Atomic size_t size;                    // Indexes handed out so far (pushed or being pushed)
+    char pad[64 - sizeof(size_t)];          // Keep the hot counter on its own cache line
+    size_t elem_size;
+    unsigned first_bits;                    // first_segment = 1 << first_bits
+    _Atomic(unsigned char*) segments[CARRAY_MAX_SEGMENTS];   // Ready flags, then elements
+} ConcurrentArray;
+
+// first_segment is rounded up to a power of 2 (0 = 1024, at most 2^20)
+// Returns NULL if allocation fails
+ConcurrentArray* carray_create(size_t elem_size, size_t first_segment);
+// NOT thread-safe: call once every thread has stopped using the array
+void carray_free(ConcurrentArray *arr);
+
+// Appends one element; returns its index, or CARRAY_FAILED if out of memory
+// (the indexes it reserved are then never published)
+size_t carray_push(ConcurrentArray *arr, const void *elem);
+// Appends count elements at consecutive indexes with ONE fetch_add;
+// returns the first index, or CARRAY_FAILED
+size_t carray_push_n(ConcurrentArray *arr, const void *elems, size_t count);
+
+// Element i, or NULL if it isn't published (yet). Wait-free
+const void* carray_at(const ConcurrentArray *arr, size_t i);
+// 0 and copies element i to out, or -1 if it isn't published
+int carray_get(const ConcurrentArray *arr, size_t i, void *out);
+
+// Indexes reserved so far - elements below this may still be in flight
+static inline size_t carray_size(const ConcurrentArray *arr) {
+    return atomic_load_explicit(&((ConcurrentArray*)arr)->size, memory_order_acquire);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
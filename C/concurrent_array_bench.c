@@ -0,0 +1,143 @@
+#define _POSIX_C_SOURCE 199309L
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "concurrent_array.h"
+#include "darray.h"
+
+// CONCURRENT ARRAY BENCHMARK
+// ==========================
+// N uint64 values appended to ONE shared array by 1, 2, 4 ... 64 threads
+// (each thread appends N / threads of them):
+// 1. DynamicArray (darray.h) with a mutex around every array_push
+// 2. carray_push - one fetch_add per element
+// 3. carray_push_n - each thread batches 256 elements, one fetch_add per batch
+// Afterwards every value 0..N-1 must be present exactly once.
+// Threads only run in parallel up to the number of CPU cores.
+//
+// Build: gcc -O2 -pthread -o program concurrent_array_bench.c concurrent_array.c darray.c arena.c && ./program [count]
+
+#define MAX_THREADS 64
+#define BATCH 256
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+typedef enum { MUTEX_DARRAY, CARRAY_PUSH, CARRAY_PUSH_N } Method;
+
+typedef struct {
+    Method method;
+    DynamicArray *darray;
+    pthread_mutex_t *lock;
+    ConcurrentArray *carray;
+    uint64_t first, count;     // This thread appends first .. first + count - 1
+    int failed;
+} Worker;
+
+static void* worker_main(void *p) {
+    Worker *w = p;
+    uint64_t end = w->first + w->count;
+    if (w->method == MUTEX_DARRAY) {
+        for (uint64_t v = w->first; v < end; v++) {
+            pthread_mutex_lock(w->lock);
+            w->failed |= array_push(w->darray, &v) != 0;
+            pthread_mutex_unlock(w->lock);
+        }
+    } else if (w->method == CARRAY_PUSH) {
+        for (uint64_t v = w->first; v < end; v++) {
+            w->failed |= carray_push(w->carray, &v) == CARRAY_FAILED;
+        }
+    } else {
+        uint64_t batch[BATCH];
+        for (uint64_t v = w->first; v < end; ) {
+            size_t n = 0;
+            while (n < BATCH && v < end) batch[n++] = v++;
+            w->failed |= carray_push_n(w->carray, batch, n) == CARRAY_FAILED;
+        }
+    }
+    return NULL;
+}
+
+// Every value 0..count-1 exactly once <=> no duplicates, none missing
+static int check_values(const uint64_t *values, size_t size, size_t count, unsigned char *seen) {
+    if (size != count) return 0;
+    for (size_t i = 0; i < count; i++) seen[i] = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (values[i] >= count || seen[values[i]]) return 0;
+        seen[values[i]] = 1;
+    }
+    return 1;
+}
+
+// Returns appends per second, *ok cleared if the array is wrong afterwards
+static double run(Method method, int threads, size_t count, uint64_t *scratch, unsigned char *seen, int *ok) {
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    DynamicArray *darray = NULL;
+    ConcurrentArray *carray = NULL;
+    if (method == MUTEX_DARRAY) darray = array_create(sizeof(uint64_t), 1024, growth_double);
+    else carray = carray_create(sizeof(uint64_t), 1024);
+    if (darray == NULL && carray == NULL) {
+        *ok = 0;
+        return 0;
+    }
+
+    pthread_t tid[MAX_THREADS];
+    Worker workers[MAX_THREADS];
+    for (int t = 0; t < threads; t++) {
+        uint64_t first = count * (uint64_t)t / threads;
+        uint64_t next = count * (uint64_t)(t + 1) / threads;
+        workers[t] = (Worker){method, darray, &lock, carray, first, next - first, 0};
+    }
+    double start = now_sec();
+    for (int t = 0; t < threads; t++) pthread_create(&tid[t], NULL, worker_main, &workers[t]);
+    for (int t = 0; t < threads; t++) pthread_join(tid[t], NULL);
+    double seconds = now_sec() - start;
+
+    for (int t = 0; t < threads; t++) *ok &= !workers[t].failed;
+    if (darray) {
+        *ok &= check_values(darray->data, darray->size, count, seen);
+        array_free(darray);
+    } else {
+        size_t size = carray_size(carray);
+        for (size_t i = 0; i < size && i < count; i++) *ok &= carray_get(carray, i, &scratch[i]) == 0;
+        *ok &= check_values(scratch, size, count, seen);
+        carray_free(carray);
+    }
+    pthread_mutex_destroy(&lock);
+    return count / seconds;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 16000000;
+    if (count == 0) count = 1;
+
+    uint64_t *scratch = malloc(count * sizeof(uint64_t));
+    unsigned char *seen = malloc(count);
+    if (scratch == NULL || seen == NULL) {
+        printf("Not enough memory for %zu elements\n", count);
+        return 1;
+    }
+    printf("%zu appends, %ld CPU core(s) online\n\n", count, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%8s %16s %16s %16s   (M appends/s)\n", "threads", "mutex+darray", "carray_push", "carray_push_n");
+
+    int ok = 1;
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        printf("%8d", threads);
+        printf(" %16.1f", run(MUTEX_DARRAY, threads, count, scratch, seen, &ok) / 1e6);
+        printf(" %16.1f", run(CARRAY_PUSH, threads, count, scratch, seen, &ok) / 1e6);
+        printf(" %16.1f\n", run(CARRAY_PUSH_N, threads, count, scratch, seen, &ok) / 1e6);
+        fflush(stdout);
+    }
+
+    printf("\n%s\n", ok ? "every value appended exactly once" : "MISMATCH: values lost or duplicated!");
+    free(scratch);
+    free(seen);
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "darray.h"
+
+// GENERIC DYNAMIC ARRAY - IMPLEMENTATION
+// ======================================
+// Same idea as efficient_dynamic_array.c:
+// - Keep size (used) and capacity (allocated) separate
+// - Only call realloc when size reaches capacity
+// - Grow geometrically so push is amortized O(1)
+// Difference: element type is erased, so every copy is memcpy(elem_size)
+
+#define PAGE_SIZE 4096
+
+// ===== GROWTH POLICIES =====
+
+size_t growth_double(size_t current, size_t needed, size_t elem_size) {
+    (void)elem_size;
+    size_t cap = current < 4 ? 4 : current * 2;
+    return cap < needed ? needed : cap;
+}
+
+size_t growth_golden(size_t current, size_t needed, size_t elem_size) {
+    (void)elem_size;
+    size_t cap = current < 4 ? 4 : current + current / 2;
+    return cap < needed ? needed : cap;
+}
+
+// Doubles, then rounds the byte size up to a whole number of pages
+// Large arrays end exactly on a page boundary - no half-used page at the end
+size_t growth_page(size_t current, size_t needed, size_t elem_size) {
+    size_t cap = growth_double(current, needed, elem_size);
+    if (cap > SIZE_MAX / elem_size - PAGE_SIZE) return cap;
+    size_t bytes = (cap * elem_size + PAGE_SIZE - 1) & ~(size_t)(PAGE_SIZE - 1);
+    return bytes / elem_size;
+}
+
+// ===== CREATE / FREE =====
+
+DynamicArray* array_create(size_t elem_size, size_t initial_capacity, GrowthPolicy grow) {
+    return array_create_in(NULL, elem_size, initial_capacity, grow);
+}
+
+DynamicArray* array_create_in(Arena *arena, size_t elem_size, size_t initial_capacity, GrowthPolicy grow) {
+    if (elem_size == 0) return NULL;
+
+    DynamicArray *arr = arena != NULL ? arena_alloc(arena, sizeof(DynamicArray))
+                                      : malloc(sizeof(DynamicArray));
+    if (arr == NULL) return NULL;
+
+    arr->data = NULL;
+    arr->size = 0;
+    arr->capacity = 0;
+    arr->elem_size = elem_size;
+    arr->grow = grow != NULL ? grow : growth_double;
+    arr->arena = arena;
+
+    if (initial_capacity > 0 && array_reserve(arr, initial_capacity) != 0) {
+        if (arena == NULL) free(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+void array_free(DynamicArray *arr) {
+    if (arr == NULL || arr->arena != NULL) return;  // Arena memory goes with arena_reset
+    free(arr->data);
+    free(arr);
+}
+
+// ===== CAPACITY =====
+
+// Resize storage to exactly new_capacity elements
+static int set_capacity(DynamicArray *arr, size_t new_capacity) {
+    if (new_capacity > SIZE_MAX / arr->elem_size) return -1;  // Byte size would overflow
+
+    size_t bytes = new_capacity * arr->elem_size;
+    void *data = arr->arena != NULL
+        ? arena_realloc(arr->arena, arr->data, arr->size * arr->elem_size, bytes)
+        : realloc(arr->data, bytes);
+    if (data == NULL && new_capacity > 0) return -1;  // Old block still valid
+
+    arr->data = data;
+    arr->capacity = new_capacity;
+    return 0;
+}
+
+int array_reserve(DynamicArray *arr, size_t min_capacity) {
+    if (min_capacity <= arr->capacity) return 0;
+    return set_capacity(arr, min_capacity);
+}
+
+int array_shrink_to_fit(DynamicArray *arr) {
+    if (arr->size == arr->capacity) return 0;
+    return set_capacity(arr, arr->size);
+}
+
+// Make room for `extra` more elements using the growth policy
+static int ensure_room(DynamicArray *arr, size_t extra) {
+    if (extra > SIZE_MAX - arr->size) return -1;
+    size_t needed = arr->size + extra;
+    if (needed <= arr->capacity) return 0;
+    return set_capacity(arr, arr->grow(arr->capacity, needed, arr->elem_size));
+}
+
+// ===== PUSH / POP =====
+
+int array_push(DynamicArray *arr, const void *elem) {
+    if (arr->size >= arr->capacity && ensure_room(arr, 1) != 0) return -1;
+    memcpy(array_at(arr, arr->size), elem, arr->elem_size);
+    arr->size++;
+    return 0;
+}
+
+// One capacity check + one memcpy for the whole block
+int array_push_n(DynamicArray *arr, const void *elems, size_t count) {
+    if (count == 0) return 0;
+    if (ensure_room(arr, count) != 0) return -1;
+    memcpy(array_at(arr, arr->size), elems, count * arr->elem_size);
+    arr->size += count;
+    return 0;
+}
+
+int array_pop(DynamicArray *arr, void *out) {
+    if (arr->size == 0) return -1;
+    arr->size--;
+    if (out != NULL) memcpy(out, array_at(arr, arr->size), arr->elem_size);
+    return 0;
+}
+
+void array_clear(DynamicArray *arr) {
+    arr->size = 0;
+}
@@ -0,0 +1,74 @@
+#ifndef DARRAY_H
+#define DARRAY_H
+
+#include <stddef.h>
+
+#include "arena.h"
+
+// GENERIC DYNAMIC ARRAY
+// =====================
+// Reusable version of the DynamicArray from efficient_dynamic_array.c
+// - Works for ANY element type: stores raw bytes, you pass elem_size
+// - Growth policy is pluggable (2x, 1.5x, page-rounded, or your own)
+// - reserve() to pre-size, shrink_to_fit() to give memory back
+// - array_push_n() copies a whole block with ONE memcpy
+// - Optional Arena backing (arena.h): array_create_in() takes its memory from an
+//   arena, and arena_reset() frees every array built in it at once
+//
+// Usage:
+//   DynamicArray *arr = array_create(sizeof(double), 16, growth_double);
+//   double x = 3.14;
+//   array_push(arr, &x);
+//   double *items = (double*)arr->data;   // Contiguous, index like a normal array
+//   array_free(arr);
+//
+// Build: gcc -O2 -o program your_file.c darray.c arena.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A growth policy returns the new capacity (in elements)
+// current = capacity now, needed = minimum capacity required
+// Must return a value >= needed
+typedef size_t (*GrowthPolicy)(size_t current, size_t needed, size_t elem_size);
+
+size_t growth_double(size_t current, size_t needed, size_t elem_size);     // 2x   - fewest reallocs
+size_t growth_golden(size_t current, size_t needed, size_t elem_size);     // 1.5x - less wasted memory
+size_t growth_page(size_t current, size_t needed, size_t elem_size);       // 2x, rounded up to whole 4 KiB pages
+
+typedef struct {
+    void *data;          // Contiguous storage (size * elem_size bytes in use)
+    size_t size;         // Current number of elements
+    size_t capacity;     // Total allocated space (in elements)
+    size_t elem_size;    // Bytes per element
+    GrowthPolicy grow;   // How capacity grows when full
+    Arena *arena;        // NULL = malloc/realloc/free, otherwise memory comes from the arena
+} DynamicArray;
+
+// Returns NULL if allocation fails
+// grow may be NULL (defaults to growth_double)
+DynamicArray* array_create(size_t elem_size, size_t initial_capacity, GrowthPolicy grow);
+// Same, but the struct and its data live in `arena` (arena may be NULL = heap)
+// Arena-backed arrays are released by arena_reset/arena_destroy; array_free is a no-op for them
+DynamicArray* array_create_in(Arena *arena, size_t elem_size, size_t initial_capacity, GrowthPolicy grow);
+void array_free(DynamicArray *arr);
+
+// All functions returning int: 0 = success, -1 = failure (out of memory / empty)
+int array_reserve(DynamicArray *arr, size_t min_capacity);
+int array_shrink_to_fit(DynamicArray *arr);
+int array_push(DynamicArray *arr, const void *elem);
+int array_push_n(DynamicArray *arr, const void *elems, size_t count);
+int array_pop(DynamicArray *arr, void *out);   // out may be NULL (just discard)
+void array_clear(DynamicArray *arr);           // size = 0, keeps capacity
+
+// Pointer to element i (no bounds check, like arr[i])
+static inline void* array_at(const DynamicArray *arr, size_t i) {
+    return (char*)arr->data + i * arr->elem_size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
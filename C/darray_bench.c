@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "darray.h"
+
+// DYNAMIC ARRAY BENCHMARK
+// =======================
+// Compares:
+// 1. realloc on EVERY push (push_back from dynamic_array.c)
+// 2. DynamicArray with each growth policy (2x, 1.5x, page-rounded)
+// 3. array_push_n bulk copy
+//
+// Build: gcc -O2 -o program darray_bench.c darray.c arena.c && ./program [count]
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Copied from dynamic_array.c - one realloc per element
+static void push_back(int **arr, int *size, int val) {
+    *arr = (int*)realloc(*arr, ++(*size) * sizeof(int));
+    (*arr)[(*size) - 1] = val;
+}
+
+static void report(const char *name, size_t count, double seconds, long long checksum) {
+    printf("%-28s %8.2f ms  %8.1f M pushes/s  (checksum %lld)\n",
+           name, seconds * 1e3, count / seconds / 1e6, checksum);
+}
+
+static void bench_realloc_per_element(size_t count) {
+    int size = 0;
+    int *arr = NULL;
+
+    double start = now_sec();
+    for (size_t i = 0; i < count; i++) {
+        push_back(&arr, &size, (int)i);
+    }
+    double elapsed = now_sec() - start;
+
+    report("realloc per element", count, elapsed, arr[count / 2]);
+    free(arr);
+}
+
+static void bench_policy(const char *name, GrowthPolicy grow, size_t count) {
+    DynamicArray *arr = array_create(sizeof(int), 0, grow);
+
+    double start = now_sec();
+    for (size_t i = 0; i < count; i++) {
+        int v = (int)i;
+        array_push(arr, &v);
+    }
+    double elapsed = now_sec() - start;
+
+    report(name, count, elapsed, ((int*)arr->data)[count / 2]);
+    array_free(arr);
+}
+
+static void bench_push_n(size_t count) {
+    enum { CHUNK = 1024 };
+    int chunk[CHUNK];
+    DynamicArray *arr = array_create(sizeof(int), 0, growth_double);
+
+    double start = now_sec();
+    for (size_t i = 0; i < count; i += CHUNK) {
+        size_t n = count - i < CHUNK ? count - i : CHUNK;
+        for (size_t j = 0; j < n; j++) chunk[j] = (int)(i + j);
+        array_push_n(arr, chunk, n);
+    }
+    double elapsed = now_sec() - start;
+
+    report("push_n (1024 per call)", count, elapsed, ((int*)arr->data)[count / 2]);
+    array_free(arr);
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    if (count == 0) count = 1;
+
+    printf("Pushing %zu ints\n\n", count);
+
+    bench_realloc_per_element(count);
+    bench_policy("DynamicArray 2x", growth_double, count);
+    bench_policy("DynamicArray 1.5x", growth_golden, count);
+    bench_policy("DynamicArray page-rounded", growth_page, count);
+    bench_push_n(count);
+
+    return 0;
+}
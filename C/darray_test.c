@@ -0,0 +1,133 @@
+#include "test_harness.h"
+#include "darray.h"
+
+// Tests and micro-benchmarks for the generic DynamicArray (darray.h)
+//
+// Build: gcc -O2 -o program darray_test.c darray.c arena.c -lm && ./program [--bench]
+
+TEST(push_and_index) {
+    DynamicArray *arr = array_create(sizeof(int), 0, NULL);
+    REQUIRE(arr != NULL);
+    for (int i = 0; i < 1000; i++) CHECK_EQ(array_push(arr, &i), 0);
+    CHECK_EQ(arr->size, 1000);
+    CHECK(arr->capacity >= 1000);
+    for (int i = 0; i < 1000; i++) CHECK_EQ(*(int*)array_at(arr, (size_t)i), i);
+    array_free(arr);
+}
+
+TEST(pop_returns_last) {
+    DynamicArray *arr = array_create(sizeof(double), 4, NULL);
+    REQUIRE(arr != NULL);
+    double x = 1.5, y = 2.5, out = 0;
+    array_push(arr, &x);
+    array_push(arr, &y);
+    CHECK_EQ(array_pop(arr, &out), 0);
+    CHECK_NEAR(out, 2.5, 0);
+    CHECK_EQ(array_pop(arr, NULL), 0);
+    CHECK_EQ(array_pop(arr, &out), -1);   // Empty
+    CHECK_EQ(arr->size, 0);
+    array_free(arr);
+}
+
+TEST(push_n_copies_block) {
+    DynamicArray *arr = array_create(sizeof(int), 2, NULL);
+    REQUIRE(arr != NULL);
+    int block[100];
+    for (int i = 0; i < 100; i++) block[i] = i * 3;
+    int first = -1;
+    array_push(arr, &first);
+    CHECK_EQ(array_push_n(arr, block, 100), 0);
+    CHECK_EQ(array_push_n(arr, block, 0), 0);
+    CHECK_EQ(arr->size, 101);
+    CHECK_MEM_EQ(array_at(arr, 1), block, sizeof block);
+    array_free(arr);
+}
+
+TEST(reserve_shrink_clear) {
+    DynamicArray *arr = array_create(sizeof(int), 0, NULL);
+    REQUIRE(arr != NULL);
+    CHECK_EQ(array_reserve(arr, 500), 0);
+    CHECK(arr->capacity >= 500);
+    void *data = arr->data;
+    for (int i = 0; i < 500; i++) array_push(arr, &i);
+    CHECK(arr->data == data);             // Reserved: no realloc while filling
+    array_clear(arr);
+    CHECK_EQ(arr->size, 0);
+    CHECK(arr->capacity >= 500);          // clear keeps the memory
+    int x = 9;
+    array_push(arr, &x);
+    CHECK_EQ(array_shrink_to_fit(arr), 0);
+    CHECK_EQ(arr->capacity, 1);
+    CHECK_EQ(*(int*)array_at(arr, 0), 9);
+    array_free(arr);
+}
+
+TEST(growth_policies) {
+    CHECK_EQ(growth_double(0, 1, 4), 4);
+    CHECK_EQ(growth_double(8, 9, 4), 16);
+    CHECK_EQ(growth_double(8, 100, 4), 100);   // Never less than needed
+    CHECK_EQ(growth_golden(8, 9, 4), 12);
+    CHECK_EQ(growth_page(8, 9, 4) * 4 % 4096, 0);
+    CHECK_EQ(growth_page(8, 9, 4), 1024);      // 16 ints rounded up to a whole page
+}
+
+TEST(arena_backed) {
+    Arena *arena = arena_create(0);
+    REQUIRE(arena != NULL);
+    DynamicArray *arr = array_create_in(arena, sizeof(int), 2, NULL);
+    REQUIRE(arr != NULL);
+    CHECK(arr->arena == arena);
+    for (int i = 0; i < 300; i++) CHECK_EQ(array_push(arr, &i), 0);
+    CHECK_EQ(*(int*)array_at(arr, 299), 299);
+    array_free(arr);          // No-op: the arena owns it
+    arena_destroy(arena);
+}
+
+// ===== BENCHMARKS =====
+
+#define BENCH_COUNT 100000
+
+BENCH(array_push_int, BENCH_COUNT) {
+    DynamicArray *arr = array_create(sizeof(int), 0, NULL);
+    for (int i = 0; i < BENCH_COUNT; i++) array_push(arr, &i);
+    bench_keep(arr->data);
+    array_free(arr);
+}
+
+BENCH(array_push_reserved, BENCH_COUNT) {
+    DynamicArray *arr = array_create(sizeof(int), BENCH_COUNT, NULL);
+    for (int i = 0; i < BENCH_COUNT; i++) array_push(arr, &i);
+    bench_keep(arr->data);
+    array_free(arr);
+}
+
+BENCH(array_push_n_block, BENCH_COUNT) {
+    static int block[1000];
+    DynamicArray *arr = array_create(sizeof(int), 0, NULL);
+    for (int i = 0; i < BENCH_COUNT / 1000; i++) array_push_n(arr, block, 1000);
+    bench_keep(arr->data);
+    array_free(arr);
+}
+
+BENCH(array_push_arena, BENCH_COUNT) {
+    Arena *arena = arena_create(0);
+    DynamicArray *arr = array_create_in(arena, sizeof(int), 0, NULL);
+    for (int i = 0; i < BENCH_COUNT; i++) array_push(arr, &i);
+    bench_keep(arr->data);
+    arena_destroy(arena);
+}
+
+BENCH(array_index_sum, BENCH_COUNT) {
+    static DynamicArray *arr;   // Built once, outside the timed part
+    if (!arr) {
+        arr = array_create(sizeof(int), BENCH_COUNT, NULL);
+        for (int i = 0; i < BENCH_COUNT; i++) array_push(arr, &i);
+    }
+    bench_start(b);
+    uint64_t sum = 0;
+    for (size_t i = 0; i < arr->size; i++) sum += (uint64_t)*(int*)array_at(arr, i);
+    bench_keep_u64(sum);
+    bench_stop(b);
+}
+
+HARNESS_MAIN()
@@ -0,0 +1,141 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deque.h"
+
+// RING-BUFFER DEQUE - IMPLEMENTATION
+// ==================================
+
+// Smallest power of two >= n
+static size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) {
+        if (p > SIZE_MAX / 2) return 0;  // Overflow
+        p <<= 1;
+    }
+    return p;
+}
+
+// Allocate a new block of new_capacity and copy contents in order to index 0
+// (Can't just realloc: a wrapped ring would come out in the wrong order)
+static int relocate(Deque *dq, size_t new_capacity) {
+    if (new_capacity > SIZE_MAX / dq->elem_size) return -1;
+
+    void *data = malloc(new_capacity * dq->elem_size);
+    if (data == NULL) return -1;
+
+    void *first, *second;
+    size_t n1, n2;
+    deque_spans(dq, &first, &n1, &second, &n2);
+    if (n1 > 0) memcpy(data, first, n1 * dq->elem_size);
+    if (n2 > 0) memcpy((char*)data + n1 * dq->elem_size, second, n2 * dq->elem_size);
+
+    free(dq->data);
+    dq->data = data;
+    dq->head = 0;
+    dq->capacity = new_capacity;
+    return 0;
+}
+
+Deque* deque_create(size_t elem_size, size_t initial_capacity) {
+    if (elem_size == 0) return NULL;
+
+    Deque *dq = malloc(sizeof(Deque));
+    if (dq == NULL) return NULL;
+
+    dq->data = NULL;
+    dq->head = 0;
+    dq->size = 0;
+    dq->capacity = 0;
+    dq->elem_size = elem_size;
+
+    if (initial_capacity > 0 && deque_reserve(dq, initial_capacity) != 0) {
+        free(dq);
+        return NULL;
+    }
+    return dq;
+}
+
+void deque_free(Deque *dq) {
+    if (dq == NULL) return;
+    free(dq->data);
+    free(dq);
+}
+
+int deque_reserve(Deque *dq, size_t min_capacity) {
+    if (min_capacity <= dq->capacity) return 0;
+    size_t cap = round_up_pow2(min_capacity);
+    if (cap == 0) return -1;
+    return relocate(dq, cap);
+}
+
+// Double when full (amortized O(1), same as array_push)
+static int ensure_room(Deque *dq) {
+    if (dq->size < dq->capacity) return 0;
+    size_t cap = dq->capacity == 0 ? 8 : dq->capacity * 2;
+    if (cap < dq->capacity) return -1;
+    return relocate(dq, cap);
+}
+
+int deque_push_back(Deque *dq, const void *elem) {
+    if (ensure_room(dq) != 0) return -1;
+    memcpy(deque_at(dq, dq->size), elem, dq->elem_size);
+    dq->size++;
+    return 0;
+}
+
+int deque_push_front(Deque *dq, const void *elem) {
+    if (ensure_room(dq) != 0) return -1;
+    // Step head back one slot - unsigned wrap + mask handles head == 0
+    dq->head = (dq->head - 1) & (dq->capacity - 1);
+    memcpy(deque_at(dq, 0), elem, dq->elem_size);
+    dq->size++;
+    return 0;
+}
+
+int deque_pop_back(Deque *dq, void *out) {
+    if (dq->size == 0) return -1;
+    dq->size--;
+    if (out != NULL) memcpy(out, deque_at(dq, dq->size), dq->elem_size);
+    return 0;
+}
+
+int deque_pop_front(Deque *dq, void *out) {
+    if (dq->size == 0) return -1;
+    if (out != NULL) memcpy(out, deque_at(dq, 0), dq->elem_size);
+    dq->head = (dq->head + 1) & (dq->capacity - 1);
+    dq->size--;
+    return 0;
+}
+
+void deque_clear(Deque *dq) {
+    dq->head = 0;
+    dq->size = 0;
+}
+
+void deque_spans(const Deque *dq, void **first, size_t *n1, void **second, size_t *n2) {
+    size_t until_end = dq->capacity - dq->head;  // Slots between head and end of buffer
+
+    *first = (char*)dq->data + dq->head * dq->elem_size;
+    if (dq->size <= until_end) {
+        *n1 = dq->size;
+        *second = NULL;
+        *n2 = 0;
+    } else {
+        *n1 = until_end;
+        *second = dq->data;            // Wrapped part starts at index 0
+        *n2 = dq->size - until_end;
+    }
+}
+
+void deque_make_contiguous(Deque *dq) {
+    if (dq->head == 0) return;
+    if (dq->head + dq->size <= dq->capacity) {
+        // Not wrapped: slide down in place
+        memmove(dq->data, deque_at(dq, 0), dq->size * dq->elem_size);
+        dq->head = 0;
+        return;
+    }
+    relocate(dq, dq->capacity);  // On failure the deque is left unchanged
+}
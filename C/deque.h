@@ -0,0 +1,65 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stddef.h>
+
+// RING-BUFFER DEQUE
+// =================
+// Double-ended queue: O(1) amortized push/pop at BOTH ends
+// Fixes shift_front/unshift_front in dynamic_array.c, which move every element
+// and call realloc on every operation (O(n) each, O(n^2) for a loop)
+//
+// How it works:
+// - Elements live in a circular buffer; `head` is the index of the first one
+// - push_front just steps head backwards (wrapping around), nothing moves
+// - Capacity is a power of two, so "wrap around" is a cheap bit mask
+// - When full, capacity doubles and the contents are unwrapped into the new block
+//
+//   capacity 8, head = 6, size = 4:   [ c d . . . . a b ]  -> logical order a b c d
+//
+// Iterating: the contents are at most TWO contiguous spans (before/after the wrap)
+//   void *first, *second; size_t n1, n2;
+//   deque_spans(dq, &first, &n1, &second, &n2);
+//
+// Build: gcc -O2 -o program your_file.c deque.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    void *data;
+    size_t head;        // Index of the first element
+    size_t size;        // Current number of elements
+    size_t capacity;    // Always 0 or a power of two
+    size_t elem_size;   // Bytes per element
+} Deque;
+
+// Returns NULL if allocation fails
+Deque* deque_create(size_t elem_size, size_t initial_capacity);
+void deque_free(Deque *dq);
+
+// 0 = success, -1 = failure (out of memory / empty)
+int deque_reserve(Deque *dq, size_t min_capacity);
+int deque_push_back(Deque *dq, const void *elem);
+int deque_push_front(Deque *dq, const void *elem);   // unshift_front
+int deque_pop_back(Deque *dq, void *out);            // out may be NULL
+int deque_pop_front(Deque *dq, void *out);           // shift_front
+void deque_clear(Deque *dq);
+
+// Pointer to logical element i (0 = front), no bounds check
+static inline void* deque_at(const Deque *dq, size_t i) {
+    return (char*)dq->data + ((dq->head + i) & (dq->capacity - 1)) * dq->elem_size;
+}
+
+// Contents in order as up to two contiguous spans (n2 == 0 when not wrapped)
+void deque_spans(const Deque *dq, void **first, size_t *n1, void **second, size_t *n2);
+
+// Rotate contents so they start at index 0 - afterwards deque_spans returns one span
+void deque_make_contiguous(Deque *dq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "deque.h"
+
+// DEQUE BENCHMARK
+// ===============
+// Mixed front/back workload: random push_front / push_back / pop_front / pop_back
+// Pushes are slightly more likely than pops, so the deque keeps growing
+// 1. Ring-buffer Deque (deque.c)
+// 2. shift_front/unshift_front from dynamic_array.c - O(n) per front op,
+//    so it only runs 1/100th of the operations (it would take hours otherwise)
+//
+// Build: gcc -O2 -o program deque_bench.c deque.c && ./program [ops]
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Cheap deterministic random numbers (xorshift)
+static uint32_t rng_state = 2463534242u;
+static uint32_t next_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// ===== BASELINE: copied from dynamic_array.c =====
+
+static void push_back(int **arr, int *size, int val) {
+    *arr = (int*)realloc(*arr, ++(*size) * sizeof(int));
+    (*arr)[(*size) - 1] = val;
+}
+
+static void pop_back(int **arr, int *size) {
+    if (*size <= 0) return;
+    *arr = (int*)realloc(*arr, --(*size) * sizeof(int));
+}
+
+static void shift_front(int **arr, int *size) {
+    if (*size <= 0) return;
+    for (int i = 1; i < *size; i++) {
+        (*arr)[i - 1] = (*arr)[i];
+    }
+    *arr = (int*)realloc(*arr, --(*size) * sizeof(int));
+}
+
+static void unshift_front(int **arr, int *size, int val) {
+    *arr = (int*)realloc(*arr, ++(*size) * sizeof(int));
+    for (int i = *size - 1; i > 0; i--) {
+        (*arr)[i] = (*arr)[i - 1];
+    }
+    (*arr)[0] = val;
+}
+
+// ===== BENCHMARKS =====
+
+// Operation mix out of 8: 3 push_back, 3 push_front, 1 pop_back, 1 pop_front
+static void bench_deque(size_t ops) {
+    Deque *dq = deque_create(sizeof(int), 0);
+    rng_state = 2463534242u;
+
+    double start = now_sec();
+    for (size_t i = 0; i < ops; i++) {
+        int v = (int)i;
+        switch (next_rand() & 7) {
+            case 0: case 1: case 2: deque_push_back(dq, &v); break;
+            case 3: case 4: case 5: deque_push_front(dq, &v); break;
+            case 6: deque_pop_back(dq, NULL); break;
+            default: deque_pop_front(dq, NULL); break;
+        }
+    }
+    double elapsed = now_sec() - start;
+
+    // Sum through the contiguous spans - plain loops the compiler can vectorize
+    void *first, *second;
+    size_t n1, n2;
+    long long sum = 0;
+    double scan_start = now_sec();
+    deque_spans(dq, &first, &n1, &second, &n2);
+    for (size_t i = 0; i < n1; i++) sum += ((int*)first)[i];
+    for (size_t i = 0; i < n2; i++) sum += ((int*)second)[i];
+    double scan = now_sec() - scan_start;
+
+    printf("%-22s %10zu ops %9.2f ms  %8.1f M ops/s  (final size %zu)\n",
+           "ring-buffer Deque", ops, elapsed * 1e3, ops / elapsed / 1e6, dq->size);
+    printf("%-22s %10zu elems %7.2f ms  (sum %lld)\n", "  span scan", dq->size, scan * 1e3, sum);
+    deque_free(dq);
+}
+
+static void bench_realloc_shift(size_t ops) {
+    int size = 0;
+    int *arr = NULL;
+    rng_state = 2463534242u;
+
+    double start = now_sec();
+    for (size_t i = 0; i < ops; i++) {
+        switch (next_rand() & 7) {
+            case 0: case 1: case 2: push_back(&arr, &size, (int)i); break;
+            case 3: case 4: case 5: unshift_front(&arr, &size, (int)i); break;
+            case 6: pop_back(&arr, &size); break;
+            default: shift_front(&arr, &size); break;
+        }
+    }
+    double elapsed = now_sec() - start;
+
+    printf("%-22s %10zu ops %9.2f ms  %8.3f M ops/s  (final size %d)\n",
+           "realloc + shift", ops, elapsed * 1e3, ops / elapsed / 1e6, size);
+    free(arr);
+}
+
+int main(int argc, char *argv[]) {
+    size_t ops = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+
+    bench_deque(ops);
+    bench_realloc_shift(ops / 100);
+    return 0;
+}
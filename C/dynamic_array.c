@@ -17,6 +17,8 @@ void pop_back(int** arr, int* size){
     *arr = (int*)realloc(*arr, --(*size) * sizeof(int));
 }
 
+// shift_front/unshift_front are O(n): every element moves and realloc runs each call
+// For front-heavy workloads use the ring-buffer Deque in deque.h (O(1) at both ends)
 void shift_front(int** arr, int* size){
     if(*size <= 0){
         printf("Cannot shift empty array.");
@@ -17,6 +17,7 @@ DynamicArray* array_create(int initial_capacity) {
 }
 
 // O(1) amortized push - only reallocates when necessary
+// Single-threaded: for many threads appending to one array see concurrent_array.h
 void array_push(DynamicArray *arr, int value) {
     if (arr->size >= arr->capacity) {
         // Double capacity when full (amortized O(1))
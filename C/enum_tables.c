@@ -0,0 +1,100 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "enum_tables.h"
+
+// ENUM TABLES - PERFECT HASH
+// ==========================
+// hash(s) = first 4 bytes XOR last 4 bytes XOR length, times a seed; the top
+// 6 bits pick one of 64 slots. At startup we try seeds until every name of
+// the enum gets a slot of its own - after that a lookup never probes.
+// An enum can't have more than 64 names (checked at compile time). If no seed
+// separates them (e.g. two names share their first 4 bytes, last 4 bytes and
+// length), the program aborts at startup with the enum's name, instead of hanging.
+// (C can't run loops at compile time; the C++ version in
+// C++/basics/enum_tables.hpp finds the seed with constexpr instead)
+
+#define SLOT_BITS 6
+#define SLOTS     (1 << SLOT_BITS)
+#define MAX_SEED_TRIES 10000   // Same cap as C++/basics/enum_tables.hpp
+
+typedef struct {
+    const char *const *names;   // Indexed by value - min (NULL = gap)
+    size_t count;
+    uint32_t seed;
+    signed char slot[SLOTS];    // Index into names, or -1
+    unsigned char len[SLOTS];   // Length of that name
+} EnumLookup;
+
+// Up to 4 bytes starting at s, as one number (missing bytes = 0)
+static uint32_t load_upto4(const char *s, size_t len) {
+    uint32_t x = 0;
+    for (size_t i = 0; i < len && i < 4; i++) x |= (uint32_t)(unsigned char)s[i] << (8 * i);
+    return x;
+}
+
+static uint32_t name_hash(uint32_t seed, const char *s, size_t len) {
+    uint32_t head = load_upto4(s, len);
+    uint32_t tail = len >= 4 ? load_upto4(s + len - 4, 4) : head;
+    return ((head ^ (tail << 1) ^ (uint32_t)len) * seed) >> (32 - SLOT_BITS);
+}
+
+static void lookup_build(EnumLookup *lookup, const char *enum_name, const char *const *names, size_t count) {
+    lookup->names = names;
+    lookup->count = count;
+    uint32_t seed = 0x9E3779B1u;
+    for (int tries = 0; tries < MAX_SEED_TRIES; tries++, seed += 0x6A09E667u) {  // Odd constants: any odd seed works
+        memset(lookup->slot, -1, sizeof(lookup->slot));
+        int collision = 0;
+        for (size_t i = 0; i < count && !collision; i++) {
+            if (names[i] == NULL) continue;
+            size_t len = strlen(names[i]);
+            uint32_t h = name_hash(seed | 1, names[i], len);
+            if (lookup->slot[h] >= 0) {
+                collision = 1;
+            } else {
+                lookup->slot[h] = (signed char)i;
+                lookup->len[h] = (unsigned char)len;
+            }
+        }
+        if (!collision) {
+            lookup->seed = seed | 1;
+            return;
+        }
+    }
+    fprintf(stderr, "enum_tables: no perfect hash for %s after %d seeds (names too alike?)\n",
+            enum_name, MAX_SEED_TRIES);
+    abort();
+}
+
+// Index of the name equal to s[0..len), or -1
+static int lookup_find(const EnumLookup *lookup, const char *s, size_t len) {
+    uint32_t h = name_hash(lookup->seed, s, len);
+    int i = lookup->slot[h];
+    if (i < 0 || lookup->len[h] != len) return -1;
+    return memcmp(lookup->names[i], s, len) == 0 ? i : -1;
+}
+
+// ===== PER-ENUM PARSERS =====
+
+#define DEFINE_ENUM_PARSER(Type, prefix)                                        \
+    _Static_assert(ENUM_ARRAY_LEN(prefix##_names) <= SLOTS,                     \
+                   #Type " has more values than perfect hash slots");           \
+    static EnumLookup prefix##_lookup;                                          \
+    __attribute__((constructor)) static void prefix##_lookup_init(void) {       \
+        lookup_build(&prefix##_lookup, #Type, prefix##_names,                   \
+                     ENUM_ARRAY_LEN(prefix##_names));                           \
+    }                                                                           \
+    int prefix##_from_string(const char *s, size_t len, Type *out) {            \
+        int i = lookup_find(&prefix##_lookup, s, len);                          \
+        if (i < 0) return -1;                                                   \
+        *out = (Type)(i + prefix##_MIN);                                        \
+        return 0;                                                               \
+    }
+
+DEFINE_ENUM_PARSER(Day, day)
+DEFINE_ENUM_PARSER(Status, status)
+DEFINE_ENUM_PARSER(Color, color)
+DEFINE_ENUM_PARSER(MenuOption, menu_option)
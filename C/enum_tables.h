@@ -0,0 +1,97 @@
+#ifndef ENUM_TABLES_H
+#define ENUM_TABLES_H
+
+#include <stddef.h>
+
+// GENERATED ENUM TABLES (X-MACROS)
+// ================================
+// c08_enums.c converts enums to text and picks actions with switch
+// statements written by hand - one more case to update for every new value.
+//
+// Here each enum is written ONCE, as a list. The list is "expanded" several
+// times with different macros to generate everything else:
+//
+//   #define COLOR_LIST(X, arg)  X(arg, RED, 0) X(arg, GREEN, 1) ...
+//
+//   enum:          RED = 0, GREEN = 1, ...
+//   to_string:     [0] = "RED", [1] = "GREEN", ...     -> array lookup, no switch
+//   handler table: [0] = color_on_RED, ...             -> one indirect call, no switch
+//
+// from_string uses a PERFECT HASH: a hash function picked (at startup) so
+// every name lands in its own slot -> one hash + one memcmp, no strcmp chain
+//
+//   Color c;
+//   if (color_from_string("BLUE", 4, &c) == 0) printf("%s\n", color_to_string(c));
+//
+// Build: gcc -O2 -o program your_file.c enum_tables.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===== THE LISTS =====
+// Same names and values as c08_enums.c. Keep each list sorted by value.
+// <prefix>_MIN is the smallest value (tables are indexed by value - MIN)
+
+#define DAY_LIST(X, arg) \
+    X(arg, MONDAY, 0) X(arg, TUESDAY, 1) X(arg, WEDNESDAY, 2) X(arg, THURSDAY, 3) \
+    X(arg, FRIDAY, 4) X(arg, SATURDAY, 5) X(arg, SUNDAY, 6)
+#define day_MIN 0
+
+#define STATUS_LIST(X, arg) \
+    X(arg, ERROR, -1) X(arg, SUCCESS, 0) X(arg, PENDING, 1) X(arg, COMPLETE, 2)
+#define status_MIN (-1)
+
+#define COLOR_LIST(X, arg) \
+    X(arg, RED, 0) X(arg, GREEN, 1) X(arg, BLUE, 2) X(arg, YELLOW, 3)
+#define color_MIN 0
+
+#define MENU_OPTION_LIST(X, arg) \
+    X(arg, OPTION_EXIT, 0) X(arg, OPTION_NEW, 1) X(arg, OPTION_OPEN, 2) \
+    X(arg, OPTION_SAVE, 3) X(arg, OPTION_QUIT, 9)
+#define menu_option_MIN 0
+
+// ===== EXPANSION MACROS =====
+
+#define ENUM_MEMBER(prefix, name, value)        name = (value),
+#define ENUM_NAME_ENTRY(prefix, name, value)    [(value) - prefix##_MIN] = #name,
+#define ENUM_HANDLER_ENTRY(prefix, name, value) [(value) - prefix##_MIN] = prefix##_on_##name,
+
+#define ENUM_ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+// Declares `enum Tag` + typedef Type, the name table, to_string and from_string
+// Gaps in the values (MenuOption jumps from 3 to 9) become NULL entries
+#define DEFINE_ENUM(Type, prefix, LIST)                                             \
+    typedef enum Type { LIST(ENUM_MEMBER, prefix) } Type;                           \
+    static const char *const prefix##_names[] = { LIST(ENUM_NAME_ENTRY, prefix) };  \
+    /* Name of v, or NULL if v isn't one of the values */                           \
+    static inline const char* prefix##_to_string(Type v) {                          \
+        size_t i = (size_t)((long)v - prefix##_MIN);                                \
+        return i < ENUM_ARRAY_LEN(prefix##_names) ? prefix##_names[i] : NULL;       \
+    }                                                                               \
+    /* 0 and *out set if s[0..len) is exactly a name, else -1 */                    \
+    int prefix##_from_string(const char *s, size_t len, Type *out);
+
+DEFINE_ENUM(Day, day, DAY_LIST)
+DEFINE_ENUM(Status, status, STATUS_LIST)
+DEFINE_ENUM(Color, color, COLOR_LIST)
+DEFINE_ENUM(MenuOption, menu_option, MENU_OPTION_LIST)
+
+// ===== HANDLER (JUMP) TABLES =====
+// Define one function per value named <prefix>_on_<NAME>, then:
+//
+//   typedef void (*ColorHandler)(void *ctx);
+//   static void color_on_RED(void *ctx) { ... }   // ... one per color
+//   DEFINE_ENUM_HANDLERS(ColorHandler, color, COLOR_LIST)
+//   color_handlers[c - color_MIN](ctx);           // Instead of switch (c)
+//
+// A missing handler is a compile error, so a new enum value can't be forgotten
+
+#define DEFINE_ENUM_HANDLERS(Handler, prefix, LIST) \
+    static const Handler prefix##_handlers[] = { LIST(ENUM_HANDLER_ENTRY, prefix) };
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
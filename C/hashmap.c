@@ -0,0 +1,274 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashmap.h"
+
+#if defined(__SSE2__)
+#define HM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#define EMPTY 0x80          // Control byte of an empty slot; full slots hold 0..127
+#define MIN_CAPACITY 16     // At least one group, so the mirrored bytes are well-defined
+#define NOT_FOUND ((size_t)-1)
+
+// Linear probing slows down sharply near full: grow at 80%
+#define MAX_LOAD(capacity) ((capacity) / 5 * 4)
+
+// ===== HASH FUNCTIONS =====
+
+static inline uint64_t avalanche(uint64_t x) {
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ull;
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ull;
+    x ^= x >> 32;
+    return x;
+}
+
+// 8 bytes per step, then a final mix so every input bit affects every output bit
+uint64_t hash_bytes(const void *key, size_t key_size) {
+    const unsigned char *p = key;
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ key_size;
+    size_t n = key_size;
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        h ^= w * 0x87c37b91114253d5ull;
+        h = ((h << 27) | (h >> 37)) * 0x4cf5ad432745937full;
+    }
+    if (n > 0) {
+        uint64_t w = 0;
+        memcpy(&w, p, n);
+        h ^= w * 0x87c37b91114253d5ull;
+        h = ((h << 27) | (h >> 37)) * 0x4cf5ad432745937full;
+    }
+    return avalanche(h);
+}
+
+uint64_t hash_cstr(const void *key, size_t key_size) {
+    (void)key_size;
+    const char *s = *(const char *const *)key;
+    return hash_bytes(s, strlen(s));
+}
+
+int equal_bytes(const void *a, const void *b, size_t key_size) {
+    return memcmp(a, b, key_size) == 0;
+}
+
+int equal_cstr(const void *a, const void *b, size_t key_size) {
+    (void)key_size;
+    return strcmp(*(const char *const *)a, *(const char *const *)b) == 0;
+}
+
+// ===== CONTROL BYTE GROUPS =====
+// Bit b of a mask = control byte b of the 16-byte group
+
+static inline unsigned group_match(const uint8_t *group, uint8_t h2) {
+#ifdef HM_SSE2
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+#else
+    unsigned mask = 0;
+    for (unsigned b = 0; b < HASHMAP_GROUP; b++) mask |= (unsigned)(group[b] == h2) << b;
+    return mask;
+#endif
+}
+
+static inline unsigned group_empty(const uint8_t *group) {
+#ifdef HM_SSE2
+    // EMPTY is the only control byte with the top bit set - movemask collects top bits
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    return group_match(group, EMPTY);
+#endif
+}
+
+static inline uint8_t hash_h2(uint64_t h) { return (uint8_t)(h >> 57); }   // Top 7 bits
+
+static inline void set_ctrl(HashMap *map, size_t i, uint8_t value) {
+    map->ctrl[i] = value;
+    if (i < HASHMAP_GROUP) map->ctrl[map->capacity + i] = value;   // Mirror: groups can read past the end
+}
+
+static inline unsigned char* slot_at(const HashMap *map, size_t i) {
+    return map->slots + i * map->slot_size;
+}
+
+// ===== CREATE / FREE =====
+
+// Largest power of 2 (up to 8) dividing size - the alignment a field of that size needs
+static size_t field_align(size_t size) {
+    size_t align = size & (~size + 1);
+    return align == 0 || align > 8 ? 8 : align;
+}
+
+static size_t round_up(size_t n, size_t align) {
+    return (n + align - 1) / align * align;
+}
+
+HashMap* hashmap_create(size_t key_size, size_t value_size, HashFn hash, KeyEqualFn equal) {
+    if (key_size == 0) return NULL;
+    HashMap *map = calloc(1, sizeof(HashMap));
+    if (map == NULL) return NULL;
+    size_t key_align = field_align(key_size);
+    size_t value_align = value_size ? field_align(value_size) : 1;
+    map->key_size = key_size;
+    map->value_size = value_size;
+    map->value_offset = round_up(key_size, value_align);
+    map->slot_size = round_up(map->value_offset + value_size, key_align > value_align ? key_align : value_align);
+    map->hash = hash != NULL ? hash : hash_bytes;
+    map->equal = equal != NULL ? equal : equal_bytes;
+    return map;
+}
+
+void hashmap_free(HashMap *map) {
+    if (map == NULL) return;
+    free(map->ctrl);
+    free(map->hashes);
+    free(map->slots);
+    free(map);
+}
+
+// ===== GROW =====
+
+// First empty slot at or after home (there always is one: the map is never full)
+static size_t find_empty(const HashMap *map, size_t home) {
+    size_t mask = map->capacity - 1;
+    for (size_t pos = home;; pos = (pos + HASHMAP_GROUP) & mask) {
+        unsigned empty = group_empty(map->ctrl + pos);
+        if (empty != 0) return (pos + (unsigned)__builtin_ctz(empty)) & mask;
+    }
+}
+
+static int resize(HashMap *map, size_t new_capacity) {
+    if (new_capacity - 1 > UINT32_MAX) return -1;   // Home slots come from 32 stored hash bits
+    if (new_capacity > SIZE_MAX / map->slot_size) return -1;
+    uint8_t *ctrl = malloc(new_capacity + HASHMAP_GROUP);
+    uint32_t *hashes = malloc(new_capacity * sizeof(uint32_t));
+    unsigned char *slots = malloc(new_capacity * map->slot_size);
+    if (ctrl == NULL || hashes == NULL || slots == NULL) {
+        free(ctrl);
+        free(hashes);
+        free(slots);
+        return -1;   // Old table untouched
+    }
+    memset(ctrl, EMPTY, new_capacity + HASHMAP_GROUP);
+
+    HashMap old = *map;
+    map->ctrl = ctrl;
+    map->hashes = hashes;
+    map->slots = slots;
+    map->capacity = new_capacity;
+    // Reinsert using the stored hash bits - the hash function is never called again
+    for (size_t i = 0; i < old.capacity; i++) {
+        if (old.ctrl[i] == EMPTY) continue;
+        size_t j = find_empty(map, old.hashes[i] & (new_capacity - 1));
+        set_ctrl(map, j, old.ctrl[i]);
+        hashes[j] = old.hashes[i];
+        memcpy(slot_at(map, j), slot_at(&old, i), map->slot_size);
+    }
+    free(old.ctrl);
+    free(old.hashes);
+    free(old.slots);
+    return 0;
+}
+
+int hashmap_reserve(HashMap *map, size_t count) {
+    size_t capacity = map->capacity ? map->capacity : MIN_CAPACITY;
+    while (MAX_LOAD(capacity) < count) {
+        if (capacity > SIZE_MAX / 2) return -1;
+        capacity *= 2;
+    }
+    return capacity > map->capacity ? resize(map, capacity) : 0;
+}
+
+// ===== LOOKUP =====
+
+static size_t find_slot(const HashMap *map, const void *key, uint64_t h) {
+    if (map->capacity == 0) return NOT_FOUND;
+    size_t mask = map->capacity - 1;
+    uint8_t h2 = hash_h2(h);
+    for (size_t pos = (uint32_t)h & mask;; pos = (pos + HASHMAP_GROUP) & mask) {
+        const uint8_t *group = map->ctrl + pos;
+        unsigned empty = group_empty(group);
+        unsigned match = group_match(group, h2);
+        // The key can only be BEFORE the first empty slot (linear probing)
+        if (empty != 0) match &= (empty & (~empty + 1)) - 1;
+        while (match != 0) {
+            size_t i = (pos + (unsigned)__builtin_ctz(match)) & mask;
+            if (map->hashes[i] == (uint32_t)h && map->equal(slot_at(map, i), key, map->key_size)) {
+                return i;
+            }
+            match &= match - 1;
+        }
+        if (empty != 0) return NOT_FOUND;
+    }
+}
+
+void* hashmap_get(const HashMap *map, const void *key) {
+    size_t i = find_slot(map, key, map->hash(key, map->key_size));
+    return i == NOT_FOUND ? NULL : slot_at(map, i) + map->value_offset;
+}
+
+// ===== PUT / REMOVE =====
+
+int hashmap_put(HashMap *map, const void *key, const void *value) {
+    uint64_t h = map->hash(key, map->key_size);
+    size_t i = find_slot(map, key, h);
+    if (i == NOT_FOUND) {
+        if (map->size + 1 > MAX_LOAD(map->capacity) &&
+            resize(map, map->capacity ? map->capacity * 2 : MIN_CAPACITY) != 0) {
+            return -1;
+        }
+        i = find_empty(map, (uint32_t)h & (map->capacity - 1));
+        set_ctrl(map, i, hash_h2(h));
+        map->hashes[i] = (uint32_t)h;
+        memcpy(slot_at(map, i), key, map->key_size);
+        map->size++;
+    }
+    if (map->value_size > 0) memcpy(slot_at(map, i) + map->value_offset, value, map->value_size);
+    return 0;
+}
+
+int hashmap_remove(HashMap *map, const void *key, void *value_out) {
+    size_t hole = find_slot(map, key, map->hash(key, map->key_size));
+    if (hole == NOT_FOUND) return -1;
+    if (value_out != NULL && map->value_size > 0) {
+        memcpy(value_out, slot_at(map, hole) + map->value_offset, map->value_size);
+    }
+
+    // Backward shift: walk the rest of the run; an entry that may sit at the
+    // hole (its home is at or before the hole) moves back into it, leaving a
+    // new hole behind. Every key stays reachable without a tombstone
+    size_t mask = map->capacity - 1;
+    for (size_t j = (hole + 1) & mask; map->ctrl[j] != EMPTY; j = (j + 1) & mask) {
+        size_t home = map->hashes[j] & mask;
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            set_ctrl(map, hole, map->ctrl[j]);
+            map->hashes[hole] = map->hashes[j];
+            memcpy(slot_at(map, hole), slot_at(map, j), map->slot_size);
+            hole = j;
+        }
+    }
+    set_ctrl(map, hole, EMPTY);
+    map->size--;
+    return 0;
+}
+
+void hashmap_clear(HashMap *map) {
+    if (map->capacity > 0) memset(map->ctrl, EMPTY, map->capacity + HASHMAP_GROUP);
+    map->size = 0;
+}
+
+int hashmap_next(const HashMap *map, size_t *iter, const void **key, void **value) {
+    for (size_t i = *iter; i < map->capacity; i++) {
+        if (map->ctrl[i] == EMPTY) continue;
+        *iter = i + 1;
+        if (key != NULL) *key = slot_at(map, i);
+        if (value != NULL) *value = slot_at(map, i) + map->value_offset;
+        return 0;
+    }
+    *iter = map->capacity;
+    return -1;
+}
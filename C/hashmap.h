@@ -0,0 +1,90 @@
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// OPEN-ADDRESSING HASH MAP
+// ========================
+// Arrays (c06_arrays.c) find things by POSITION. To find a struct Person by
+// NAME you have to scan: compare every element until one matches - O(n).
+// A hash map turns the key into a slot number, so a lookup checks ~1 slot - O(1).
+//
+// Layout (SwissTable-style):
+// - One CONTROL byte per slot: 0x80 = empty, otherwise 7 bits of the key's hash
+// - Keys and values live in a separate slot array
+// - Lookup compares 16 control bytes at once (one SSE2 instruction); only slots
+//   whose 7 bits match get a real key comparison (~1 in 128 false alarms)
+// - Linear probing: a key sits at its home slot or after it, before the next empty slot
+// - Deletion shifts the following entries back (backward-shift), so there are
+//   no "deleted" markers (tombstones) slowing lookups down after many removals
+//
+// Generic like darray.h: keys and values are raw bytes of a fixed size.
+// The hash and key comparison are pluggable (NULL = compare the raw bytes).
+// For C-string keys store the char* itself and use hash_cstr / equal_cstr.
+//
+//   HashMap *ages = hashmap_create(sizeof(char*), sizeof(int), hash_cstr, equal_cstr);
+//   const char *name = "John";   // The map stores the POINTER - keep the text alive
+//   int age = 32;
+//   hashmap_put(ages, &name, &age);
+//   int *found = hashmap_get(ages, &name);   // NULL if missing
+//   hashmap_free(ages);
+//
+// Build: gcc -O2 -o program your_file.c hashmap.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HASHMAP_GROUP 16   // Control bytes compared per step
+
+// hash: any well-mixed 64-bit value (the map uses both the low and the top bits)
+typedef uint64_t (*HashFn)(const void *key, size_t key_size);
+// equal: nonzero if the two keys are the same
+typedef int (*KeyEqualFn)(const void *a, const void *b, size_t key_size);
+
+uint64_t hash_bytes(const void *key, size_t key_size);      // Default: hashes the key's bytes
+uint64_t hash_cstr(const void *key, size_t key_size);       // Key is a const char* - hashes the text
+int equal_bytes(const void *a, const void *b, size_t key_size);
+int equal_cstr(const void *a, const void *b, size_t key_size);
+
+typedef struct {
+    uint8_t *ctrl;           // capacity + HASHMAP_GROUP bytes: the last 16 repeat the first 16
+    uint32_t *hashes;        // Low 32 hash bits per slot: growing and deleting never rehash keys
+    unsigned char *slots;    // capacity * slot_size bytes: key, then value
+    size_t capacity;         // Power of 2 (>= 16), or 0 before the first put
+    size_t size;
+    size_t key_size, value_size;
+    size_t value_offset;     // Value position inside a slot (aligned)
+    size_t slot_size;
+    HashFn hash;
+    KeyEqualFn equal;
+} HashMap;
+
+// hash/equal may be NULL (hash_bytes / equal_bytes). value_size may be 0 (a set)
+// Returns NULL if allocation fails
+HashMap* hashmap_create(size_t key_size, size_t value_size, HashFn hash, KeyEqualFn equal);
+void hashmap_free(HashMap *map);
+
+// All functions returning int: 0 = success, -1 = failure (out of memory / not found)
+int hashmap_reserve(HashMap *map, size_t count);   // Room for count keys without growing
+int hashmap_put(HashMap *map, const void *key, const void *value);   // Insert or overwrite
+int hashmap_remove(HashMap *map, const void *key, void *value_out);  // value_out may be NULL
+void hashmap_clear(HashMap *map);                                     // size = 0, keeps capacity
+
+// Pointer to the value stored for key, or NULL. Valid until the next put/remove
+void* hashmap_get(const HashMap *map, const void *key);
+
+static inline size_t hashmap_size(const HashMap *map) { return map->size; }
+
+// Iteration (any order):
+//   size_t it = 0; const void *key; void *value;
+//   while (hashmap_next(map, &it, &key, &value) == 0) { ... }
+// Don't put or remove while iterating
+int hashmap_next(const HashMap *map, size_t *iter, const void **key, void **value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,142 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "darray.h"
+#include "hashmap.h"
+#include "records.h"
+
+// HASH MAP BENCHMARK
+// ==================
+// N people (struct Person from c07_structs.c), looked up by name:
+// 1. Linear search: strcmp every Person in a DynamicArray until the name matches
+// 2. HashMap: name (char* into the array) -> index in the array
+// 3. std::map<string, int> name -> age, as in C++/datastructures/c06_maps.cpp
+//    (in hashmap_bench_map.cpp)
+// 90% of lookups find a person, 10% look for a name that isn't there.
+// Linear search does fewer lookups at large N (each one scans ~N/2 people);
+// all times are per operation.
+//
+// Build: g++ -O2 -c hashmap_bench_map.cpp && gcc -O2 -o program hashmap_bench.c hashmap.c darray.c arena.c hashmap_bench_map.o -lstdc++ && ./program [max_people]
+
+#define LOOKUPS 1000000
+
+void std_map_bench(const char *const *names, const int *ages, size_t count,
+                   const char *const *queries, size_t lookups,
+                   double *insert_sec, double *lookup_sec, long long *age_sum);
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned seed = 1;
+static unsigned next_random(void) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 1;
+}
+
+// c07-style linear search: index of the person called name, or -1
+__attribute__((noinline)) static long find_person_linear(const DynamicArray *people, const char *name) {
+    const struct Person *p = people->data;
+    for (size_t i = 0; i < people->size; i++) {
+        if (strcmp(p[i].name, name) == 0) return (long)i;
+    }
+    return -1;
+}
+
+int main(int argc, char *argv[]) {
+    size_t max_people = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    if (max_people < 100) max_people = 100;
+
+    // Query strings live in their own buffer: a lookup never gets the stored pointer
+    char (*query_text)[50] = malloc(LOOKUPS * sizeof *query_text);
+    const char **queries = malloc(LOOKUPS * sizeof(char*));
+    if (!query_text || !queries) return 1;
+
+    printf("%zu lookups per size (90%% found), ns per operation\n\n", (size_t)LOOKUPS);
+    printf("%9s | %10s %10s | %10s %10s %10s\n", "people", "put", "map insert", "linear", "hashmap", "std::map");
+    int agree = 1;
+
+    for (size_t count = 100; count <= max_people; count *= 10) {
+        DynamicArray *people = array_create(sizeof(struct Person), count, NULL);
+        const char **names = malloc(count * sizeof(char*));
+        int *ages = malloc(count * sizeof(int));
+        for (size_t i = 0; i < count; i++) {
+            struct Person p;
+            memset(&p, 0, sizeof p);
+            snprintf(p.name, sizeof p.name, "person-%u-%zu", next_random() % 100000, i);
+            p.age = (int)(next_random() % 90);
+            p.height = 1.5f + (float)(next_random() % 50) / 100;
+            array_push(people, &p);
+        }
+        // The array is complete: pointers to its names stay valid from here on
+        struct Person *person = people->data;
+        for (size_t i = 0; i < count; i++) {
+            names[i] = person[i].name;
+            ages[i] = person[i].age;
+        }
+        for (size_t q = 0; q < LOOKUPS; q++) {
+            if (next_random() % 10 == 0) snprintf(query_text[q], 50, "nobody-%zu", q);
+            else strcpy(query_text[q], names[next_random() % count]);
+            queries[q] = query_text[q];
+        }
+
+        // HashMap: build the index over the array
+        double start = now_sec();
+        HashMap *index = hashmap_create(sizeof(char*), sizeof(uint32_t), hash_cstr, equal_cstr);
+        for (size_t i = 0; i < count; i++) {
+            uint32_t at = (uint32_t)i;
+            hashmap_put(index, &names[i], &at);
+        }
+        double put_sec = now_sec() - start;
+
+        start = now_sec();
+        long long hash_sum = 0;
+        for (size_t q = 0; q < LOOKUPS; q++) {
+            uint32_t *at = hashmap_get(index, &queries[q]);
+            if (at) hash_sum += person[*at].age;
+        }
+        double hash_sec = now_sec() - start;
+
+        // Linear search: cap the work at ~2e8 comparisons per size
+        size_t linear_lookups = (size_t)2e8 / count;
+        if (linear_lookups > LOOKUPS) linear_lookups = LOOKUPS;
+        if (linear_lookups < 100) linear_lookups = 100;
+        start = now_sec();
+        long long linear_sum = 0;
+        for (size_t q = 0; q < linear_lookups; q++) {
+            long at = find_person_linear(people, queries[q]);
+            if (at >= 0) linear_sum += person[at].age;
+        }
+        double linear_sec = now_sec() - start;
+        long long check_sum = 0;   // HashMap over the same queries
+        for (size_t q = 0; q < linear_lookups; q++) {
+            uint32_t *at = hashmap_get(index, &queries[q]);
+            if (at) check_sum += person[*at].age;
+        }
+
+        double insert_sec, map_sec;
+        long long map_sum;
+        std_map_bench(names, ages, count, queries, LOOKUPS, &insert_sec, &map_sec, &map_sum);
+
+        agree &= hash_sum == map_sum && linear_sum == check_sum;
+        printf("%9zu | %10.1f %10.1f | %10.1f %10.1f %10.1f\n", count,
+               put_sec / count * 1e9, insert_sec / count * 1e9,
+               linear_sec / linear_lookups * 1e9, hash_sec / LOOKUPS * 1e9, map_sec / LOOKUPS * 1e9);
+        fflush(stdout);
+
+        hashmap_free(index);
+        array_free(people);
+        free(names);
+        free(ages);
+    }
+
+    printf("\n%s\n", agree ? "all versions agree" : "MISMATCH between versions!");
+    free(query_text);
+    free(queries);
+    return 0;
+}
@@ -0,0 +1,34 @@
+// std::map side of hashmap_bench.c
+//
+// The same name -> age lookups with map<string, int>, as in C++/datastructures/c06_maps.cpp.
+// extern "C" lets the C benchmark call it; compile it with g++ and link with -lstdc++.
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+
+using namespace std;
+
+static double now_sec() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+extern "C" void std_map_bench(const char *const *names, const int *ages, size_t count,
+                              const char *const *queries, size_t lookups,
+                              double *insert_sec, double *lookup_sec, long long *age_sum) {
+	double start = now_sec();
+	map<string, int> people;
+	for (size_t i = 0; i < count; i++) people[names[i]] = ages[i];
+	*insert_sec = now_sec() - start;
+
+	// Keys arrive as C strings, so every find builds a temporary string - as a C caller would
+	long long sum = 0;
+	start = now_sec();
+	for (size_t i = 0; i < lookups; i++) {
+		auto it = people.find(queries[i]);
+		if (it != people.end()) sum += it->second;
+	}
+	*lookup_sec = now_sec() - start;
+	*age_sum = sum;
+}
@@ -0,0 +1,178 @@
+#include "test_harness.h"
+#include "hashmap.h"
+
+// Tests and micro-benchmarks for the open-addressing HashMap (hashmap.h)
+//
+// Build: gcc -O2 -o program hashmap_test.c hashmap.c -lm && ./program [--bench]
+
+TEST(put_get_overwrite) {
+    HashMap *map = hashmap_create(sizeof(int), sizeof(double), NULL, NULL);
+    REQUIRE(map != NULL);
+    int key = 7;
+    double value = 1.5;
+    CHECK(hashmap_get(map, &key) == NULL);   // Empty map: nothing allocated yet
+    CHECK_EQ(hashmap_put(map, &key, &value), 0);
+    value = 2.5;
+    CHECK_EQ(hashmap_put(map, &key, &value), 0);   // Same key: overwrite, size stays 1
+    CHECK_EQ(hashmap_size(map), 1);
+    double *found = hashmap_get(map, &key);
+    REQUIRE(found != NULL);
+    CHECK_NEAR(*found, 2.5, 0);
+    hashmap_free(map);
+}
+
+TEST(cstr_keys) {
+    HashMap *ages = hashmap_create(sizeof(char*), sizeof(int), hash_cstr, equal_cstr);
+    REQUIRE(ages != NULL);
+    const char *names[] = {"John", "Adele", "Bo"};
+    int values[] = {32, 45, 29};
+    for (int i = 0; i < 3; i++) hashmap_put(ages, &names[i], &values[i]);
+    char buffer[8] = "Adele";   // Different pointer, same text
+    const char *lookup = buffer;
+    int *age = hashmap_get(ages, &lookup);
+    REQUIRE(age != NULL);
+    CHECK_EQ(*age, 45);
+    int removed = 0;
+    CHECK_EQ(hashmap_remove(ages, &lookup, &removed), 0);
+    CHECK_EQ(removed, 45);
+    CHECK(hashmap_get(ages, &lookup) == NULL);
+    CHECK_EQ(hashmap_remove(ages, &lookup, NULL), -1);
+    CHECK_EQ(hashmap_size(ages), 2);
+    hashmap_free(ages);
+}
+
+// Every key lands in the same home slot: one long run, the worst case for
+// backward-shift deletion and for groups that wrap around the end of the table
+static uint64_t hash_collide(const void *key, size_t key_size) {
+    (void)key_size;
+    return 13 | ((uint64_t)(*(const int*)key % 3) << 57);   // 3 different h2 values
+}
+
+TEST(collisions_and_wraparound) {
+    HashMap *map = hashmap_create(sizeof(int), sizeof(int), hash_collide, NULL);
+    REQUIRE(map != NULL);
+    for (int k = 0; k < 40; k++) CHECK_EQ(hashmap_put(map, &k, &k), 0);
+    for (int k = 0; k < 40; k += 3) CHECK_EQ(hashmap_remove(map, &k, NULL), 0);
+    for (int k = 0; k < 40; k++) {
+        int *v = hashmap_get(map, &k);
+        if (k % 3 == 0) CHECK(v == NULL);
+        else CHECK(v != NULL && *v == k);
+    }
+    hashmap_free(map);
+}
+
+// Random puts/removes checked against a plain array indexed by key
+TEST(random_against_array) {
+    enum { KEYS = 5000, OPS = 200000 };
+    static int reference[KEYS];   // -1 = absent
+    for (int k = 0; k < KEYS; k++) reference[k] = -1;
+    HashMap *map = hashmap_create(sizeof(int), sizeof(int), NULL, NULL);
+    REQUIRE(map != NULL);
+    unsigned seed = 42;
+    size_t expected_size = 0;
+    for (int op = 0; op < OPS; op++) {
+        seed = seed * 1103515245u + 12345u;
+        int key = (int)((seed >> 8) % KEYS);
+        if ((seed >> 4) % 3 == 0) {
+            int removed = -2;
+            int result = hashmap_remove(map, &key, &removed);
+            CHECK_EQ(result, reference[key] == -1 ? -1 : 0);
+            if (result == 0) {
+                CHECK_EQ(removed, reference[key]);
+                expected_size--;
+            }
+            reference[key] = -1;
+        } else {
+            if (reference[key] == -1) expected_size++;
+            reference[key] = op;
+            CHECK_EQ(hashmap_put(map, &key, &op), 0);
+        }
+    }
+    CHECK_EQ(hashmap_size(map), expected_size);
+    for (int k = 0; k < KEYS; k++) {
+        int *v = hashmap_get(map, &k);
+        if (reference[k] == -1) CHECK(v == NULL);
+        else CHECK(v != NULL && *v == reference[k]);
+    }
+    size_t it = 0, seen = 0;
+    const void *key;
+    void *value;
+    while (hashmap_next(map, &it, &key, &value) == 0) {
+        seen++;
+        CHECK_EQ(*(int*)value, reference[*(const int*)key]);
+    }
+    CHECK_EQ(seen, expected_size);
+    hashmap_free(map);
+}
+
+TEST(churn_does_not_grow) {
+    // Without tombstones, removing and re-adding never fills the table up
+    HashMap *map = hashmap_create(sizeof(int), sizeof(int), NULL, NULL);
+    REQUIRE(map != NULL);
+    REQUIRE(hashmap_reserve(map, 1000) == 0);
+    size_t capacity = map->capacity;
+    for (int round = 0; round < 100; round++) {
+        for (int k = 0; k < 1000; k++) {
+            int key = round * 1000 + k;
+            hashmap_put(map, &key, &k);
+        }
+        for (int k = 0; k < 1000; k++) {
+            int key = round * 1000 + k;
+            hashmap_remove(map, &key, NULL);
+        }
+    }
+    CHECK_EQ(hashmap_size(map), 0);
+    CHECK_EQ(map->capacity, capacity);
+    hashmap_free(map);
+}
+
+TEST(set_and_clear) {
+    HashMap *set = hashmap_create(sizeof(uint64_t), 0, NULL, NULL);   // value_size 0 = a set
+    REQUIRE(set != NULL);
+    for (uint64_t k = 0; k < 100; k++) CHECK_EQ(hashmap_put(set, &k, NULL), 0);
+    uint64_t k = 50;
+    CHECK(hashmap_get(set, &k) != NULL);
+    hashmap_clear(set);
+    CHECK_EQ(hashmap_size(set), 0);
+    CHECK(hashmap_get(set, &k) == NULL);
+    hashmap_free(set);
+}
+
+// ===== BENCHMARKS =====
+
+#define BENCH_KEYS 100000
+
+static HashMap* bench_map(void) {
+    static HashMap *map;
+    if (!map) {
+        map = hashmap_create(sizeof(uint64_t), sizeof(uint64_t), NULL, NULL);
+        for (uint64_t k = 0; k < BENCH_KEYS; k++) hashmap_put(map, &k, &k);
+    }
+    return map;
+}
+
+BENCH(hashmap_put_u64, BENCH_KEYS) {
+    HashMap *map = hashmap_create(sizeof(uint64_t), sizeof(uint64_t), NULL, NULL);
+    for (uint64_t k = 0; k < BENCH_KEYS; k++) hashmap_put(map, &k, &k);
+    hashmap_free(map);
+}
+
+BENCH(hashmap_get_hit, BENCH_KEYS) {
+    HashMap *map = bench_map();
+    bench_start(b);
+    uint64_t sum = 0;
+    for (uint64_t k = 0; k < BENCH_KEYS; k++) sum += *(uint64_t*)hashmap_get(map, &k);
+    bench_keep_u64(sum);
+    bench_stop(b);
+}
+
+BENCH(hashmap_get_miss, BENCH_KEYS) {
+    HashMap *map = bench_map();
+    bench_start(b);
+    uint64_t misses = 0;
+    for (uint64_t k = BENCH_KEYS; k < 2 * BENCH_KEYS; k++) misses += hashmap_get(map, &k) == NULL;
+    bench_keep_u64(misses);
+    bench_stop(b);
+}
+
+HARNESS_MAIN()
@@ -0,0 +1,116 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "line_reader.h"
+
+// BUFFERED LINE READER - IMPLEMENTATION
+// =====================================
+// Buffer layout:
+//
+//   [ already returned | unread bytes ........ | free space ]
+//   0                  start                   end          cap
+//
+// When no '\n' is left in the unread bytes, slide them to the front
+// and read() another block after them
+
+LineReader* line_reader_from_fd(int fd, size_t block_size) {
+    LineReader *reader = malloc(sizeof(LineReader));
+    if (reader == NULL) return NULL;
+
+    reader->block = block_size > 0 ? block_size : LINE_READER_BLOCK;
+    reader->cap = reader->block;
+    reader->buf = malloc(reader->cap);
+    if (reader->buf == NULL) {
+        free(reader);
+        return NULL;
+    }
+    reader->fd = fd;
+    reader->owns_fd = 0;
+    reader->eof = 0;
+    reader->start = reader->end = reader->scanned = 0;
+    return reader;
+}
+
+LineReader* line_reader_open(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    LineReader *reader = line_reader_from_fd(fd, 0);
+    if (reader == NULL) {
+        close(fd);
+        return NULL;
+    }
+    reader->owns_fd = 1;
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);  // Hint: read-ahead aggressively
+#endif
+    return reader;
+}
+
+void line_reader_close(LineReader *reader) {
+    if (reader == NULL) return;
+    if (reader->owns_fd) close(reader->fd);
+    free(reader->buf);
+    free(reader);
+}
+
+// Make room for at least one more block after the unread bytes, then read it
+// Returns bytes read (0 = end of file) or -1 on error
+static ssize_t fill(LineReader *reader) {
+    size_t unread = reader->end - reader->start;
+
+    if (reader->start > 0) {
+        memmove(reader->buf, reader->buf + reader->start, unread);
+        reader->start = 0;
+        reader->end = unread;
+    }
+    if (reader->cap - reader->end < reader->block) {
+        // One line is bigger than the buffer: grow it
+        char *bigger = realloc(reader->buf, reader->cap * 2);
+        if (bigger == NULL) return -1;
+        reader->buf = bigger;
+        reader->cap *= 2;
+    }
+
+    ssize_t n;
+    do {
+        n = read(reader->fd, reader->buf + reader->end, reader->cap - reader->end);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0) reader->end += (size_t)n;
+    return n;
+}
+
+int line_reader_next(LineReader *reader, LineView *line) {
+    for (;;) {
+        char *from = reader->buf + reader->start + reader->scanned;
+        size_t left = reader->end - reader->start - reader->scanned;
+        char *newline = memchr(from, '\n', left);
+
+        if (newline != NULL) {
+            line->data = reader->buf + reader->start;
+            line->len = (size_t)(newline - line->data);
+            reader->start += line->len + 1;
+            reader->scanned = 0;
+            return 1;
+        }
+        reader->scanned += left;  // Don't search these bytes again after refilling
+
+        if (reader->eof) {
+            if (reader->start == reader->end) return 0;
+            // Last line has no '\n'
+            line->data = reader->buf + reader->start;
+            line->len = reader->end - reader->start;
+            reader->start = reader->end;
+            reader->scanned = 0;
+            return 1;
+        }
+
+        ssize_t n = fill(reader);
+        if (n < 0) return -1;
+        if (n == 0) reader->eof = 1;
+    }
+}
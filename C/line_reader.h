@@ -0,0 +1,70 @@
+#ifndef LINE_READER_H
+#define LINE_READER_H
+
+#include <stddef.h>
+
+// BUFFERED LINE READER
+// ====================
+// Replacement for the `char buffer[100]` + fgets loop in c12_files.c
+// Problems with that loop:
+// - Lines longer than 99 chars come back split into pieces
+// - One library call per line, and every byte is copied into buffer
+//
+// LineReader instead:
+// - read()s big blocks (1 MiB by default) straight from the file
+// - Finds line ends with memchr (vectorized in every modern libc)
+// - Returns a VIEW (pointer + length) into its own buffer - no copy
+// - Any line length works: the buffer grows if one line is bigger than it
+//
+//   LineReader *r = line_reader_open("example.txt");
+//   LineView line;
+//   while (line_reader_next(r, &line) == 1) {
+//       printf("%.*s\n", (int)line.len, line.data);   // NOT NUL-terminated!
+//   }
+//   line_reader_close(r);
+//
+// A view is only valid until the next line_reader_next call - copy it to keep it
+//
+// Build: gcc -O2 -o program your_file.c line_reader.c   (POSIX only)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LINE_READER_BLOCK (1024 * 1024)
+
+typedef struct {
+    const char *data;   // First character of the line
+    size_t len;         // Length WITHOUT the '\n'
+} LineView;
+
+typedef struct {
+    int fd;
+    int owns_fd;        // Close fd in line_reader_close?
+    int eof;
+    char *buf;
+    size_t cap;         // Buffer size
+    size_t start;       // First unread byte
+    size_t end;         // One past the last valid byte
+    size_t scanned;     // Bytes from start already searched for '\n'
+    size_t block;       // Bytes requested per read()
+} LineReader;
+
+// Returns NULL if the file can't be opened or memory runs out
+LineReader* line_reader_open(const char *path);
+
+// Read from an already-open descriptor (not closed by line_reader_close)
+// block_size 0 = LINE_READER_BLOCK
+LineReader* line_reader_from_fd(int fd, size_t block_size);
+
+void line_reader_close(LineReader *reader);
+
+// 1 = line returned, 0 = end of file, -1 = read error / out of memory
+// A final line without '\n' is still returned
+int line_reader_next(LineReader *reader, LineView *line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
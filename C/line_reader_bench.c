@@ -0,0 +1,120 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "line_reader.h"
+
+// LINE READER BENCHMARK
+// =====================
+// Writes a text file with random line lengths (1..250 chars, so ~60% of
+// lines are longer than the 100-byte fgets buffer), then reads it back with:
+// 1. fgets + char buffer[100]  (c12_files.c) - counts pieces, not lines!
+// 2. getline                   (POSIX, grows its buffer, copies each line)
+// 3. LineReader                (1 MiB blocks + memchr, zero-copy views)
+// All three read a warm (already cached) file, so this measures CPU cost per line
+//
+// Build: gcc -O2 -o program line_reader_bench.c line_reader.c && ./program [megabytes]
+
+#define BENCH_FILE "bench_lines.txt"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t write_file(size_t bytes) {
+    FILE *file = fopen(BENCH_FILE, "w");
+    if (file == NULL) {
+        printf("Error creating %s\n", BENCH_FILE);
+        exit(1);
+    }
+
+    char line[256];
+    memset(line, 'x', sizeof(line));
+    size_t written = 0, lines = 0;
+    unsigned state = 1;
+    while (written < bytes) {
+        state = state * 1103515245u + 12345u;
+        size_t len = 1 + (state >> 16) % 250;
+        line[len] = '\n';
+        fwrite(line, 1, len + 1, file);
+        line[len] = 'x';
+        written += len + 1;
+        lines++;
+    }
+    fclose(file);
+    return lines;
+}
+
+static void report(const char *name, size_t lines, size_t bytes, double seconds, size_t checksum) {
+    printf("%-24s %10zu lines %9.2f ms  %7.1f M lines/s  %6.2f GB/s  (chars %zu)\n",
+           name, lines, seconds * 1e3, lines / seconds / 1e6, bytes / seconds / 1e9, checksum);
+}
+
+static void bench_fgets(size_t bytes) {
+    FILE *file = fopen(BENCH_FILE, "r");
+    char buffer[100];
+    size_t calls = 0, chars = 0;
+
+    double start = now_sec();
+    while (fgets(buffer, sizeof(buffer), file) != NULL) {
+        chars += strlen(buffer);
+        calls++;
+    }
+    double elapsed = now_sec() - start;
+    fclose(file);
+
+    report("fgets buffer[100]", calls, bytes, elapsed, chars);
+}
+
+static void bench_getline(size_t bytes) {
+    FILE *file = fopen(BENCH_FILE, "r");
+    char *line = NULL;
+    size_t cap = 0, lines = 0, chars = 0;
+    ssize_t len;
+
+    double start = now_sec();
+    while ((len = getline(&line, &cap, file)) != -1) {
+        chars += (size_t)len;
+        lines++;
+    }
+    double elapsed = now_sec() - start;
+    free(line);
+    fclose(file);
+
+    report("getline", lines, bytes, elapsed, chars);
+}
+
+static void bench_line_reader(size_t bytes) {
+    LineView line;
+    size_t lines = 0, chars = 0;
+
+    double start = now_sec();
+    LineReader *reader = line_reader_open(BENCH_FILE);
+    while (line_reader_next(reader, &line) == 1) {
+        chars += line.len + 1;  // + 1 for the '\n' the others include
+        lines++;
+    }
+    line_reader_close(reader);
+    double elapsed = now_sec() - start;
+
+    report("LineReader", lines, bytes, elapsed, chars);
+}
+
+int main(int argc, char *argv[]) {
+    size_t megabytes = argc > 1 ? strtoull(argv[1], NULL, 10) : 2048;
+    size_t bytes = megabytes * 1024 * 1024;
+
+    size_t lines = write_file(bytes);
+    printf("%zu MiB, %zu lines (fgets \"lines\" are really pieces of <= 99 chars)\n\n", megabytes, lines);
+
+    bench_fgets(bytes);
+    bench_getline(bytes);
+    bench_line_reader(bytes);
+
+    remove(BENCH_FILE);
+    return 0;
+}
@@ -0,0 +1,230 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lstring.h"
+
+// LENGTH-PREFIXED STRINGS - IMPLEMENTATION
+// ========================================
+// SSE2 is part of every x86-64 CPU, so it is used directly (no runtime check)
+// Other CPUs get the plain byte loops
+
+#if defined(__SSE2__)
+#define LSTR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// ===== CREATE / CONVERT =====
+
+LString* lstr_with_capacity(size_t cap) {
+    if (cap == SIZE_MAX) return NULL;
+    LString *s = malloc(sizeof(LString));
+    if (s == NULL) return NULL;
+
+    s->data = malloc(cap + 1);  // + 1 for the '\0'
+    if (s->data == NULL) {
+        free(s);
+        return NULL;
+    }
+    s->data[0] = '\0';
+    s->len = 0;
+    s->cap = cap;
+    return s;
+}
+
+LString* lstr_from(const char *data, size_t len) {
+    LString *s = lstr_with_capacity(len);
+    if (s == NULL) return NULL;
+    memcpy(s->data, data, len);
+    s->data[len] = '\0';
+    s->len = len;
+    return s;
+}
+
+LString* lstr_new(const char *cstr) {
+    return lstr_from(cstr, strlen(cstr));
+}
+
+void lstr_free(LString *s) {
+    if (s == NULL) return;
+    free(s->data);
+    free(s);
+}
+
+char* lstr_to_cstr(const LString *s) {
+    char *copy = malloc(s->len + 1);
+    if (copy == NULL) return NULL;
+    memcpy(copy, s->data, s->len + 1);
+    return copy;
+}
+
+// ===== MODIFY =====
+
+int lstr_reserve(LString *s, size_t cap) {
+    if (cap <= s->cap) return 0;
+    if (cap == SIZE_MAX) return -1;
+    char *data = realloc(s->data, cap + 1);
+    if (data == NULL) return -1;
+    s->data = data;
+    s->cap = cap;
+    return 0;
+}
+
+int lstr_append(LString *s, const char *data, size_t len) {
+    if (len > SIZE_MAX - 1 - s->len) return -1;
+    size_t needed = s->len + len;
+    if (needed > s->cap) {
+        // Appending part of s to itself: realloc may move it, so remember the offset
+        int inside = data >= s->data && data <= s->data + s->len;
+        size_t offset = inside ? (size_t)(data - s->data) : 0;
+
+        size_t cap = s->cap < 16 ? 16 : s->cap * 2;  // Double: amortized O(1)
+        if (cap < needed) cap = needed;
+        if (lstr_reserve(s, cap) != 0) return -1;
+        if (inside) data = s->data + offset;
+    }
+    memmove(s->data + s->len, data, len);  // memmove: source may overlap (self-append)
+    s->len = needed;
+    s->data[needed] = '\0';
+    return 0;
+}
+
+int lstr_append_cstr(LString *s, const char *cstr) {
+    return lstr_append(s, cstr, strlen(cstr));
+}
+
+int lstr_append_lstr(LString *s, const LString *other) {
+    return lstr_append(s, other->data, other->len);
+}
+
+void lstr_clear(LString *s) {
+    s->len = 0;
+    s->data[0] = '\0';
+}
+
+// ===== FIND =====
+// SSE2 version: compare 16 candidate positions at once on the needle's
+// FIRST and LAST byte. Only positions where both match get a full memcmp.
+// (Checking two bytes rejects far more false starts than just the first.)
+
+static size_t find_scalar(const char *hay, size_t hay_len, const char *needle, size_t needle_len, size_t from) {
+    while (from + needle_len <= hay_len) {
+        const char *hit = memchr(hay + from, needle[0], hay_len - needle_len - from + 1);
+        if (hit == NULL) return LSTR_NPOS;
+        size_t pos = (size_t)(hit - hay);
+        if (memcmp(hit + 1, needle + 1, needle_len - 1) == 0) return pos;
+        from = pos + 1;
+    }
+    return LSTR_NPOS;
+}
+
+size_t lstr_find(const LString *s, const char *needle, size_t needle_len, size_t from) {
+    if (needle_len == 0) return from <= s->len ? from : LSTR_NPOS;
+    if (from > s->len || needle_len > s->len - from) return LSTR_NPOS;
+
+    const char *hay = s->data;
+    size_t pos = from;
+
+#ifdef LSTR_SSE2
+    if (needle_len > 1) {
+        __m128i first = _mm_set1_epi8(needle[0]);
+        __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+        // Unrolled: 32 positions per step, most steps find no candidate at all
+        while (pos + needle_len - 1 + 32 <= s->len) {
+            const char *p = hay + pos;
+            __m128i eq_lo = _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), first),
+                _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + needle_len - 1)), last));
+            __m128i eq_hi = _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 16)), first),
+                _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 16 + needle_len - 1)), last));
+            if (_mm_movemask_epi8(_mm_or_si128(eq_lo, eq_hi)) != 0) {
+                uint32_t mask = (uint32_t)_mm_movemask_epi8(eq_lo) | (uint32_t)_mm_movemask_epi8(eq_hi) << 16;
+                while (mask != 0) {
+                    unsigned bit = (unsigned)__builtin_ctz(mask);
+                    if (memcmp(p + bit + 1, needle + 1, needle_len - 2) == 0) return pos + bit;
+                    mask &= mask - 1;  // Clear lowest set bit
+                }
+            }
+            pos += 32;
+        }
+        // Last block: both 16-byte loads must stay inside the string
+        while (pos + needle_len - 1 + 16 <= s->len) {
+            __m128i block_first = _mm_loadu_si128((const __m128i*)(hay + pos));
+            __m128i block_last = _mm_loadu_si128((const __m128i*)(hay + pos + needle_len - 1));
+            unsigned mask = (unsigned)_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+            while (mask != 0) {
+                unsigned bit = (unsigned)__builtin_ctz(mask);
+                if (memcmp(hay + pos + bit + 1, needle + 1, needle_len - 2) == 0) return pos + bit;
+                mask &= mask - 1;  // Clear lowest set bit
+            }
+            pos += 16;
+        }
+    }
+#endif
+
+    return find_scalar(hay, s->len, needle, needle_len, pos);
+}
+
+// ===== COMPARE =====
+
+int lstr_compare(const LString *a, const LString *b) {
+    size_t n = a->len < b->len ? a->len : b->len;
+    size_t i = 0;
+
+#ifdef LSTR_SSE2
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a->data + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b->data + i));
+        unsigned diff = ~(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) & 0xFFFF;
+        if (diff != 0) {
+            size_t k = i + (unsigned)__builtin_ctz(diff);  // First differing byte
+            return (unsigned char)a->data[k] - (unsigned char)b->data[k];
+        }
+    }
+#endif
+
+    int result = memcmp(a->data + i, b->data + i, n - i);
+    if (result != 0) return result;
+    return (a->len > b->len) - (a->len < b->len);
+}
+
+int lstr_equals(const LString *a, const LString *b) {
+    return a->len == b->len && memcmp(a->data, b->data, a->len) == 0;
+}
+
+// ===== SPLIT =====
+
+static int push_view(DynamicArray *out, const char *data, size_t len) {
+    LStringView view = { data, len };
+    return array_push(out, &view);
+}
+
+int lstr_split(const LString *s, char delim, DynamicArray *out) {
+    const char *data = s->data;
+    size_t field_start = 0;
+    size_t i = 0;
+
+#ifdef LSTR_SSE2
+    __m128i d = _mm_set1_epi8(delim);
+    for (; i + 16 <= s->len; i += 16) {
+        unsigned mask = (unsigned)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i)), d));
+        while (mask != 0) {
+            size_t at = i + (unsigned)__builtin_ctz(mask);
+            if (push_view(out, data + field_start, at - field_start) != 0) return -1;
+            field_start = at + 1;
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < s->len; i++) {
+        if (data[i] == delim) {
+            if (push_view(out, data + field_start, i - field_start) != 0) return -1;
+            field_start = i + 1;
+        }
+    }
+    return push_view(out, data + field_start, s->len - field_start);
+}
@@ -0,0 +1,85 @@
+#ifndef LSTRING_H
+#define LSTRING_H
+
+#include <stddef.h>
+
+#include "darray.h"
+
+// LENGTH-PREFIXED STRINGS
+// =======================
+// c03_strings.c uses plain NUL-terminated char arrays, so:
+// - strlen walks the whole string to find '\0'           -> O(n)
+// - strcat first walks the destination to find its end   -> O(n) per append
+// - building a string with n strcat calls                -> O(n^2)
+//
+// LString stores the length next to the characters:
+// - lstr_len is O(1), append is amortized O(1) (capacity doubles like DynamicArray)
+// - Strings may contain '\0' bytes (length says where they end, not '\0')
+// - data is ALWAYS followed by a '\0', so lstr_cstr() can be passed to printf etc.
+// - find / compare / split scan 16 bytes per step with SSE2 (plain loops elsewhere)
+//
+//   LString *s = lstr_new("Hello");
+//   lstr_append_cstr(s, ", World");
+//   printf("%s (%zu chars)\n", lstr_cstr(s), lstr_len(s));
+//   lstr_free(s);
+//
+// Build: gcc -O2 -o program your_file.c lstring.c darray.c arena.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LSTR_NPOS ((size_t)-1)   // "Not found" from lstr_find
+
+typedef struct {
+    char *data;     // len chars + '\0'
+    size_t len;
+    size_t cap;     // Chars that fit before the '\0' slot
+} LString;
+
+// Borrowed piece of a string (NOT NUL-terminated) - e.g. a field from lstr_split
+typedef struct {
+    const char *data;
+    size_t len;
+} LStringView;
+
+// ===== CREATE / CONVERT =====
+// All constructors return NULL if out of memory
+
+LString* lstr_new(const char *cstr);                      // From a C string
+LString* lstr_from(const char *data, size_t len);         // From any bytes
+LString* lstr_with_capacity(size_t cap);                  // Empty, pre-sized
+void lstr_free(LString *s);
+
+static inline size_t lstr_len(const LString *s) { return s->len; }
+static inline const char* lstr_cstr(const LString *s) { return s->data; }  // O(1), no copy
+char* lstr_to_cstr(const LString *s);   // malloc'd copy - caller frees
+
+// ===== MODIFY =====
+// 0 = success, -1 = out of memory (string unchanged)
+
+int lstr_reserve(LString *s, size_t cap);
+int lstr_append(LString *s, const char *data, size_t len);
+int lstr_append_cstr(LString *s, const char *cstr);
+int lstr_append_lstr(LString *s, const LString *other);
+void lstr_clear(LString *s);
+
+// ===== SEARCH / COMPARE / SPLIT =====
+
+// Index of the first occurrence of needle at or after `from`, or LSTR_NPOS
+size_t lstr_find(const LString *s, const char *needle, size_t needle_len, size_t from);
+
+// Like strcmp (<0, 0, >0) but uses lengths; a prefix sorts first
+int lstr_compare(const LString *a, const LString *b);
+int lstr_equals(const LString *a, const LString *b);
+
+// Push one LStringView per field onto `out` (a DynamicArray of LStringView)
+// "a,,b" split on ',' gives "a", "", "b". Views point into s - don't free s first
+// 0 = success, -1 = out of memory
+int lstr_split(const LString *s, char delim, DynamicArray *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,117 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lstring.h"
+
+// LSTRING BENCHMARK
+// =================
+// 1. Building a string from N small pieces: strcat (rescans every time) vs lstr_append
+// 2. Searching a large text: strstr vs lstr_find
+//    (glibc's strstr is itself vectorized, so expect lstr_find to be close, not far ahead)
+// 3. Splitting a CSV-like line: strtok vs lstr_split
+//
+// Build: gcc -O2 -o program lstring_bench.c lstring.c darray.c arena.c && ./program [pieces]
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static const char *piece = "item,";   // 5 chars per append
+
+static void bench_build(size_t pieces) {
+    size_t total = pieces * strlen(piece);
+
+    // strcat: each call walks the whole destination to find its '\0' -> O(n^2)
+    char *buffer = malloc(total + 1);
+    buffer[0] = '\0';
+    double start = now_sec();
+    for (size_t i = 0; i < pieces; i++) strcat(buffer, piece);
+    double strcat_time = now_sec() - start;
+
+    LString *s = lstr_with_capacity(0);
+    start = now_sec();
+    for (size_t i = 0; i < pieces; i++) lstr_append_cstr(s, piece);
+    double append_time = now_sec() - start;
+
+    printf("build %zu pieces:  strcat %10.2f ms   lstr_append %8.3f ms   (%s)\n",
+           pieces, strcat_time * 1e3, append_time * 1e3,
+           strcmp(buffer, lstr_cstr(s)) == 0 ? "same result" : "MISMATCH");
+    free(buffer);
+    lstr_free(s);
+}
+
+static void bench_find(void) {
+    // 64 MiB of random lowercase text with the needle at the very end
+    size_t len = 64 * 1024 * 1024;
+    LString *text = lstr_with_capacity(len);
+    unsigned seed = 12345;
+    for (size_t i = 0; i < len - 16; i++) {
+        seed = seed * 1103515245u + 12345u;
+        char c = "abcdefghij klmnopqrstuvwxyz"[(seed >> 16) % 27];
+        lstr_append(text, &c, 1);
+    }
+    lstr_append_cstr(text, "needle-in-stack");
+    const char *needle = "needle-in-stack";
+
+    // strstr is a "pure" function: the compiler may call it only once for a loop
+    // with the same arguments, so read the pointer through volatile and sum results
+    const char *volatile hay = lstr_cstr(text);
+    int reps = 10;
+    size_t found_strstr = 0, found_lstr = 0;
+
+    double start = now_sec();
+    for (int r = 0; r < reps; r++) found_strstr += (size_t)(strstr(hay, needle) - hay);
+    double strstr_time = (now_sec() - start) / reps;
+
+    start = now_sec();
+    for (int r = 0; r < reps; r++) found_lstr += lstr_find(text, needle, strlen(needle), 0);
+    double find_time = (now_sec() - start) / reps;
+
+    printf("find in %zu MiB:   strstr %10.2f ms   lstr_find   %8.3f ms   (%s)\n",
+           len >> 20, strstr_time * 1e3, find_time * 1e3,
+           found_strstr == found_lstr ? "same result" : "MISMATCH");
+    lstr_free(text);
+}
+
+static void bench_split(void) {
+    // One long line of short fields: "f0,f1,f2,..."
+    LString *line = lstr_with_capacity(0);
+    char field[32];
+    size_t fields = 2000000;
+    for (size_t i = 0; i < fields; i++) {
+        int n = snprintf(field, sizeof(field), i == 0 ? "f%zu" : ",f%zu", i);
+        lstr_append(line, field, (size_t)n);
+    }
+
+    char *copy = lstr_to_cstr(line);  // strtok destroys its input
+    size_t count_strtok = 0;
+    double start = now_sec();
+    for (char *tok = strtok(copy, ","); tok != NULL; tok = strtok(NULL, ",")) count_strtok++;
+    double strtok_time = now_sec() - start;
+    free(copy);
+
+    DynamicArray *views = array_create(sizeof(LStringView), 0, NULL);
+    start = now_sec();
+    lstr_split(line, ',', views);
+    double split_time = now_sec() - start;
+
+    printf("split %zu fields: strtok %10.2f ms   lstr_split  %8.3f ms   (%s)\n",
+           fields, strtok_time * 1e3, split_time * 1e3,
+           count_strtok == views->size ? "same count" : "MISMATCH");
+    array_free(views);
+    lstr_free(line);
+}
+
+int main(int argc, char *argv[]) {
+    size_t pieces = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000;
+
+    bench_build(pieces);
+    bench_find();
+    bench_split();
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "test_harness.h"
+#include "lstring.h"
+
+// Tests and micro-benchmarks for the length-prefixed strings (lstring.h)
+//
+// Build: gcc -O2 -o program lstring_test.c lstring.c darray.c arena.c -lm && ./program [--bench]
+
+TEST(new_and_append) {
+    LString *s = lstr_new("hello");
+    REQUIRE(s != NULL);
+    CHECK_EQ(lstr_len(s), 5);
+    CHECK_EQ(lstr_append_cstr(s, ", world"), 0);
+    CHECK_EQ(lstr_len(s), 12);
+    CHECK_STR_EQ(lstr_cstr(s), "hello, world");   // Always '\0'-terminated
+    lstr_clear(s);
+    CHECK_EQ(lstr_len(s), 0);
+    CHECK_STR_EQ(lstr_cstr(s), "");
+    lstr_free(s);
+}
+
+TEST(embedded_nul_bytes) {
+    LString *s = lstr_from("a\0b", 3);   // strlen would say 1
+    REQUIRE(s != NULL);
+    CHECK_EQ(lstr_len(s), 3);
+    CHECK_EQ(lstr_find(s, "b", 1, 0), 2);
+    lstr_free(s);
+}
+
+TEST(find_positions) {
+    LString *s = lstr_new("abcabcabc-the end of a longer string to cross 16 and 32 bytes: needle!");
+    REQUIRE(s != NULL);
+    CHECK_EQ(lstr_find(s, "abc", 3, 0), 0);
+    CHECK_EQ(lstr_find(s, "abc", 3, 1), 3);
+    CHECK_EQ(lstr_find(s, "needle", 6, 0), lstr_len(s) - 7);
+    CHECK_EQ(lstr_find(s, "!", 1, 0), lstr_len(s) - 1);
+    CHECK(lstr_find(s, "needles", 7, 0) == LSTR_NPOS);
+    CHECK(lstr_find(s, "abc", 3, lstr_len(s)) == LSTR_NPOS);
+    CHECK_EQ(lstr_find(s, "", 0, 4), 4);   // Empty needle matches where the search starts
+    lstr_free(s);
+}
+
+TEST(find_matches_strstr) {
+    // Every needle position and length in a random a/b text, against strstr
+    char text[200];
+    unsigned seed = 7;
+    for (int i = 0; i < 199; i++) {
+        seed = seed * 1103515245u + 12345u;
+        text[i] = (char)('a' + (seed >> 16) % 2);
+    }
+    text[199] = '\0';
+    LString *s = lstr_new(text);
+    REQUIRE(s != NULL);
+    for (size_t start = 0; start < 190; start += 7) {
+        for (size_t len = 1; len <= 9; len++) {
+            const char *needle = text + start;
+            char copy[16];
+            memcpy(copy, needle, len);
+            copy[len] = '\0';
+            size_t expected = (size_t)(strstr(text, copy) - text);
+            CHECK_EQ(lstr_find(s, copy, len, 0), expected);
+        }
+    }
+    lstr_free(s);
+}
+
+TEST(compare_and_equals) {
+    LString *a = lstr_new("apple"), *b = lstr_new("apples"), *c = lstr_new("apple");
+    REQUIRE(a && b && c);
+    CHECK(lstr_compare(a, b) < 0);   // A prefix sorts first
+    CHECK(lstr_compare(b, a) > 0);
+    CHECK_EQ(lstr_compare(a, c), 0);
+    CHECK(lstr_equals(a, c));
+    CHECK(!lstr_equals(a, b));
+    lstr_free(a);
+    lstr_free(b);
+    lstr_free(c);
+}
+
+TEST(split_fields) {
+    LString *s = lstr_new("a,,b,a much longer field that crosses sixteen bytes,");
+    DynamicArray *fields = array_create(sizeof(LStringView), 0, NULL);
+    REQUIRE(s && fields);
+    CHECK_EQ(lstr_split(s, ',', fields), 0);
+    REQUIRE(fields->size == 5);
+    LStringView *v = fields->data;
+    CHECK_EQ(v[0].len, 1);
+    CHECK_EQ(v[1].len, 0);
+    CHECK(v[2].len == 1 && v[2].data[0] == 'b');
+    CHECK_EQ(v[3].len, strlen("a much longer field that crosses sixteen bytes"));
+    CHECK_EQ(v[4].len, 0);   // Trailing delimiter = empty last field
+    array_free(fields);
+    lstr_free(s);
+}
+
+// ===== BENCHMARKS =====
+
+#define TEXT_SIZE (64 * 1024)
+
+// 64 KB of random lowercase words, built once
+static LString* bench_text(void) {
+    static LString *text;
+    if (!text) {
+        text = lstr_with_capacity(TEXT_SIZE);
+        unsigned seed = 1;
+        while (lstr_len(text) < TEXT_SIZE - 1) {
+            seed = seed * 1103515245u + 12345u;
+            char c = (seed >> 16) % 6 == 0 ? ' ' : (char)('a' + (seed >> 8) % 26);
+            lstr_append(text, &c, 1);
+        }
+    }
+    return text;
+}
+
+BENCH(lstr_append_word, 100000) {
+    LString *s = lstr_with_capacity(0);
+    for (int i = 0; i < 100000; i++) lstr_append(s, "word ", 5);
+    bench_keep(s->data);
+    lstr_free(s);
+}
+
+BENCH(lstr_find_64k_byte, TEXT_SIZE) {      // Per byte scanned, needle not present
+    LString *text = bench_text();
+    bench_start(b);
+    bench_keep_u64(lstr_find(text, "zzzzq", 5, 0));
+    bench_stop(b);
+}
+
+BENCH(lstr_split_64k_byte, TEXT_SIZE) {
+    LString *text = bench_text();
+    static DynamicArray *fields;
+    if (!fields) fields = array_create(sizeof(LStringView), TEXT_SIZE, NULL);
+    array_clear(fields);
+    bench_start(b);
+    lstr_split(text, ' ', fields);
+    bench_stop(b);
+    bench_keep(fields->data);
+}
+
+HARNESS_MAIN()
@@ -0,0 +1,156 @@
+#include <limits.h>
+
+#include "math_kernels.h"
+
+// MATH KERNELS - IMPLEMENTATION
+// =============================
+// The loops below are written so compilers can vectorize them:
+// - restrict pointers (no aliasing checks needed)
+// - no early exits, no function calls, no branches in the body
+//   (`x > m ? x : m` becomes a SIMD max instruction)
+
+// ===== FACTORIAL TABLES =====
+// Precomputed (generated once with Python's math.factorial)
+
+const uint64_t factorial_u64_table[FACTORIAL_U64_MAX + 1] = {
+    1ULL,                     // 0!
+    1ULL,                     // 1!
+    2ULL,                     // 2!
+    6ULL,                     // 3!
+    24ULL,                    // 4!
+    120ULL,                   // 5!
+    720ULL,                   // 6!
+    5040ULL,                  // 7!
+    40320ULL,                 // 8!
+    362880ULL,                // 9!
+    3628800ULL,               // 10!
+    39916800ULL,              // 11!
+    479001600ULL,             // 12!
+    6227020800ULL,            // 13!
+    87178291200ULL,           // 14!
+    1307674368000ULL,         // 15!
+    20922789888000ULL,        // 16!
+    355687428096000ULL,       // 17!
+    6402373705728000ULL,      // 18!
+    121645100408832000ULL,    // 19!
+    2432902008176640000ULL,   // 20!
+};
+
+int factorial_u64_checked(unsigned n, uint64_t *out) {
+    if (n > FACTORIAL_U64_MAX) return -1;
+    *out = factorial_u64_table[n];
+    return 0;
+}
+
+#ifdef __SIZEOF_INT128__
+// No 128-bit literals in C: build each value from its high and low 64 bits
+#define U128(hi, lo) (((unsigned __int128)(hi) << 64) | (lo))
+
+static const unsigned __int128 factorial_u128_table[FACTORIAL_U128_MAX + 1] = {
+    U128(0x0000000000000000ULL, 0x0000000000000001ULL),  // 0!
+    U128(0x0000000000000000ULL, 0x0000000000000001ULL),  // 1!
+    U128(0x0000000000000000ULL, 0x0000000000000002ULL),  // 2!
+    U128(0x0000000000000000ULL, 0x0000000000000006ULL),  // 3!
+    U128(0x0000000000000000ULL, 0x0000000000000018ULL),  // 4!
+    U128(0x0000000000000000ULL, 0x0000000000000078ULL),  // 5!
+    U128(0x0000000000000000ULL, 0x00000000000002d0ULL),  // 6!
+    U128(0x0000000000000000ULL, 0x00000000000013b0ULL),  // 7!
+    U128(0x0000000000000000ULL, 0x0000000000009d80ULL),  // 8!
+    U128(0x0000000000000000ULL, 0x0000000000058980ULL),  // 9!
+    U128(0x0000000000000000ULL, 0x0000000000375f00ULL),  // 10!
+    U128(0x0000000000000000ULL, 0x0000000002611500ULL),  // 11!
+    U128(0x0000000000000000ULL, 0x000000001c8cfc00ULL),  // 12!
+    U128(0x0000000000000000ULL, 0x000000017328cc00ULL),  // 13!
+    U128(0x0000000000000000ULL, 0x000000144c3b2800ULL),  // 14!
+    U128(0x0000000000000000ULL, 0x0000013077775800ULL),  // 15!
+    U128(0x0000000000000000ULL, 0x0000130777758000ULL),  // 16!
+    U128(0x0000000000000000ULL, 0x0001437eeecd8000ULL),  // 17!
+    U128(0x0000000000000000ULL, 0x0016beecca730000ULL),  // 18!
+    U128(0x0000000000000000ULL, 0x01b02b9306890000ULL),  // 19!
+    U128(0x0000000000000000ULL, 0x21c3677c82b40000ULL),  // 20!
+    U128(0x0000000000000002ULL, 0xc5077d36b8c40000ULL),  // 21!
+    U128(0x000000000000003cULL, 0xeea4c2b3e0d80000ULL),  // 22!
+    U128(0x0000000000000579ULL, 0x70cd7e2933680000ULL),  // 23!
+    U128(0x0000000000008362ULL, 0x9343d3dcd1c00000ULL),  // 24!
+    U128(0x00000000000cd4a0ULL, 0x619fb0907bc00000ULL),  // 25!
+    U128(0x00000000014d9849ULL, 0xea37eeac91800000ULL),  // 26!
+    U128(0x00000000232f0fcbULL, 0xb3e62c3358800000ULL),  // 27!
+    U128(0x00000003d925ba47ULL, 0xad2cd59dae000000ULL),  // 28!
+    U128(0x0000006f99461a1eULL, 0x9e1432dcb6000000ULL),  // 29!
+    U128(0x00000d13f6370f96ULL, 0x865df5dd54000000ULL),  // 30!
+    U128(0x0001956ad0aae33aULL, 0x4560c5cd2c000000ULL),  // 31!
+    U128(0x0032ad5a155c6748ULL, 0xac18b9a580000000ULL),  // 32!
+    U128(0x0688589cc0e9505eULL, 0x2f2fee5580000000ULL),  // 33!
+    U128(0xde1bc4d19efcac82ULL, 0x445da75b00000000ULL),  // 34!
+};
+
+int factorial_u128_checked(unsigned n, unsigned __int128 *out) {
+    if (n > FACTORIAL_U128_MAX) return -1;
+    *out = factorial_u128_table[n];
+    return 0;
+}
+#endif
+
+size_t factorial_many(const unsigned *restrict n, uint64_t *restrict out, size_t count) {
+    size_t overflows = 0;
+    for (size_t i = 0; i < count; i++) {
+        unsigned k = n[i];
+        int fits = k <= FACTORIAL_U64_MAX;
+        out[i] = fits ? factorial_u64_table[fits ? k : 0] : 0;  // Index is always in range
+        overflows += !fits;
+    }
+    return overflows;
+}
+
+// ===== DIVMOD =====
+
+void divmod_many(const int32_t *restrict dividend, const int32_t *restrict divisor,
+                 int32_t *restrict quotient, int32_t *restrict remainder, size_t count) {
+    // x86 has no SIMD integer divide, but it has SIMD double divide.
+    // Any int32 fits exactly in a double, and for 32-bit inputs the rounded
+    // double quotient never crosses an integer, so truncating it is exact
+    for (size_t i = 0; i < count; i++) {
+        int32_t q = (int32_t)((double)dividend[i] / (double)divisor[i]);
+        quotient[i] = q;
+        remainder[i] = dividend[i] - q * divisor[i];
+    }
+}
+
+void divmod_many_by(const uint32_t *restrict dividend, uint32_t divisor,
+                    uint32_t *restrict quotient, uint32_t *restrict remainder, size_t count) {
+    // "Division by invariant integers using multiplication" (Granlund & Montgomery):
+    // with l = ceil(log2(d)) and m = floor(2^32 * (2^l - d) / d) + 1,
+    //   t = (m * n) >> 32,   n / d = (t + ((n - t) >> 1)) >> (l - 1)
+    // (shift amounts clamped so d = 1 works too)
+    unsigned l = 0;
+    while (l < 32 && ((uint64_t)1 << l) < divisor) l++;
+    uint32_t m = (uint32_t)((((uint64_t)1 << l) - divisor) * ((uint64_t)1 << 32) / divisor + 1);
+    unsigned shift1 = l < 1 ? l : 1;
+    unsigned shift2 = l > 0 ? l - 1 : 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t n = dividend[i];
+        uint32_t t = (uint32_t)(((uint64_t)m * n) >> 32);
+        uint32_t q = (t + ((n - t) >> shift1)) >> shift2;
+        quotient[i] = q;
+        remainder[i] = n - q * divisor;
+    }
+}
+
+// ===== MAX =====
+
+void max3_many(const int *restrict a, const int *restrict b, const int *restrict c,
+               int *restrict out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        int m = a[i];
+        m = b[i] > m ? b[i] : m;
+        m = c[i] > m ? c[i] : m;
+        out[i] = m;
+    }
+}
+
+int max_array(const int *a, size_t count) {
+    int m = INT_MIN;
+    for (size_t i = 0; i < count; i++) m = a[i] > m ? a[i] : m;
+    return m;
+}
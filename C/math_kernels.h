@@ -0,0 +1,75 @@
+#ifndef MATH_KERNELS_H
+#define MATH_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// MATH KERNELS
+// ============
+// Faster, safer versions of the small functions in c11_functions.c
+//
+// factorial:
+// - c11's recursive int version overflows at 13! (silently wrong results)
+// - Only 21 factorials fit in 64 bits (0! .. 20!) and 35 in 128 bits
+//   (0! .. 34!), so they are simply PRECOMPUTED: a lookup, no loop, no recursion
+// - The _checked versions return -1 instead of a wrong answer
+//
+// Batched ("_many") versions take whole arrays:
+// - One call per array instead of one per element
+// - restrict promises the arrays don't overlap, so the compiler can
+//   vectorize the loops (process 4-16 elements per instruction)
+// - Compile with -O3 (or -O2 -ftree-vectorize) to get the SIMD versions
+//
+// Build: gcc -O3 -o program your_file.c math_kernels.c   (add -march=native for AVX2)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FACTORIAL_U64_MAX  20   // 21! > UINT64_MAX
+#define FACTORIAL_U128_MAX 34   // 35! > 2^128 - 1
+
+extern const uint64_t factorial_u64_table[FACTORIAL_U64_MAX + 1];
+
+// n! for n <= 20; 0 (never a real factorial) for n > 20
+static inline uint64_t factorial_u64(unsigned n) {
+    return n <= FACTORIAL_U64_MAX ? factorial_u64_table[n] : 0;
+}
+
+// 0 and *out = n!, or -1 if n! doesn't fit
+int factorial_u64_checked(unsigned n, uint64_t *out);
+
+#ifdef __SIZEOF_INT128__
+// GCC/Clang 128-bit integers (not part of standard C)
+int factorial_u128_checked(unsigned n, unsigned __int128 *out);
+#endif
+
+// out[i] = n[i]! (0 where it doesn't fit in 64 bits); returns how many didn't fit
+size_t factorial_many(const unsigned *restrict n, uint64_t *restrict out, size_t count);
+
+// ===== DIVMOD =====
+// Like c11's divmod(a, b, &q, &r) for every i: C rules (truncate toward zero)
+// Divisors must be non-zero, and INT32_MIN / -1 is not allowed (as with /)
+void divmod_many(const int32_t *restrict dividend, const int32_t *restrict divisor,
+                 int32_t *restrict quotient, int32_t *restrict remainder, size_t count);
+
+// Same divisor for every element: the division becomes a multiply + shifts
+// (what compilers do for a constant like x / 7, but computed at run time)
+// divisor must be non-zero (as with /)
+void divmod_many_by(const uint32_t *restrict dividend, uint32_t divisor,
+                    uint32_t *restrict quotient, uint32_t *restrict remainder, size_t count);
+
+// ===== MAX =====
+
+// out[i] = max(a[i], b[i], c[i]) - c11's max() over whole arrays
+void max3_many(const int *restrict a, const int *restrict b, const int *restrict c,
+               int *restrict out, size_t count);
+
+// Largest element (INT_MIN if count == 0)
+int max_array(const int *a, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,150 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "math_kernels.h"
+
+// MATH KERNELS BENCHMARK
+// ======================
+// The per-call functions from c11_functions.c (called once per element,
+// as if from another file) vs the table / batched versions.
+// Every version writes its results to an output array, so all move the same memory:
+// 1. factorial: recursive int vs factorial_u64 lookup vs factorial_many
+// 2. divmod: per-call vs divmod_many vs divmod_many_by (same divisor)
+// 3. max of three: per-call vs max3_many
+//
+// Build: gcc -O3 -o program math_kernels_bench.c math_kernels.c && ./program [count]
+//        (add -march=native to let the batched loops use AVX2)
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char *name, double seconds, size_t count) {
+    printf("  %-24s %8.2f ms  %8.1f M/s\n", name, seconds * 1e3, count / seconds / 1e6);
+}
+
+// ===== c11_functions.c VERSIONS =====
+// noinline: a function in another .c file can't be inlined (without LTO)
+
+__attribute__((noinline)) static int factorial(int n) {
+    if (n <= 1) {
+        return 1;
+    }
+    return n * factorial(n - 1);
+}
+
+__attribute__((noinline)) static void divmod(int dividend, int divisor, int *quotient, int *remainder) {
+    *quotient = dividend / divisor;
+    *remainder = dividend % divisor;
+}
+
+__attribute__((noinline)) static int max(int a, int b, int c) {
+    int maximum = a;
+    if (b > maximum) maximum = b;
+    if (c > maximum) maximum = c;
+    return maximum;
+}
+
+static long long sum_u64(const uint64_t *x, size_t count) {
+    long long sum = 0;
+    for (size_t i = 0; i < count; i++) sum += (long long)x[i];
+    return sum;
+}
+
+static long long sum_i32(const int32_t *x, size_t count) {
+    long long sum = 0;
+    for (size_t i = 0; i < count; i++) sum += x[i];
+    return sum;
+}
+
+static unsigned seed = 3;
+static unsigned next_random(void) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 1;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    if (count == 0) count = 1;
+
+    unsigned *n = malloc(count * sizeof(unsigned));
+    uint64_t *fact = malloc(count * sizeof(uint64_t));
+    int32_t *a = malloc(count * sizeof(int32_t));
+    int32_t *b = malloc(count * sizeof(int32_t));
+    int32_t *c = malloc(count * sizeof(int32_t));
+    int32_t *q = malloc(count * sizeof(int32_t));
+    int32_t *r = malloc(count * sizeof(int32_t));
+    for (size_t i = 0; i < count; i++) {
+        n[i] = next_random() % 13;  // 12! is the largest that fits in c11's int
+        a[i] = (int32_t)next_random() - (1 << 30);
+        b[i] = (int32_t)(next_random() % 1000) + 1;
+        c[i] = (int32_t)next_random() - (1 << 30);
+    }
+    // Touch the output arrays now, so page faults aren't counted as kernel time
+    memset(fact, 0, count * sizeof(uint64_t));
+    memset(q, 0, count * sizeof(int32_t));
+    memset(r, 0, count * sizeof(int32_t));
+    printf("%zu elements\n\n", count);
+    long long expected, mismatches = 0;
+
+    printf("factorial (n = 0..12):\n");
+    double start = now_sec();
+    for (size_t i = 0; i < count; i++) fact[i] = (uint64_t)factorial((int)n[i]);
+    report("recursive (c11)", now_sec() - start, count);
+    expected = sum_u64(fact, count);
+    start = now_sec();
+    for (size_t i = 0; i < count; i++) fact[i] = factorial_u64(n[i]);
+    report("factorial_u64 table", now_sec() - start, count);
+    mismatches += sum_u64(fact, count) != expected;
+    start = now_sec();
+    factorial_many(n, fact, count);
+    report("factorial_many", now_sec() - start, count);
+    mismatches += sum_u64(fact, count) != expected;
+
+    printf("divmod (divisors 1..1000):\n");
+    start = now_sec();
+    for (size_t i = 0; i < count; i++) divmod(a[i], b[i], &q[i], &r[i]);
+    report("per-call divmod (c11)", now_sec() - start, count);
+    expected = sum_i32(q, count) + sum_i32(r, count);
+    start = now_sec();
+    divmod_many(a, b, q, r, count);
+    report("divmod_many", now_sec() - start, count);
+    mismatches += sum_i32(q, count) + sum_i32(r, count) != expected;
+
+    for (size_t i = 0; i < count; i++) a[i] &= INT32_MAX;  // divmod_many_by is unsigned
+    uint32_t *ua = (uint32_t*)a, *uq = (uint32_t*)q, *ur = (uint32_t*)r;
+    start = now_sec();
+    for (size_t i = 0; i < count; i++) divmod(a[i], 7, &q[i], &r[i]);
+    report("per-call divmod by 7", now_sec() - start, count);
+    expected = sum_i32(q, count) + sum_i32(r, count);
+    start = now_sec();
+    divmod_many_by(ua, 7, uq, ur, count);
+    report("divmod_many_by 7", now_sec() - start, count);
+    mismatches += sum_i32(q, count) + sum_i32(r, count) != expected;
+
+    printf("max of three:\n");
+    start = now_sec();
+    for (size_t i = 0; i < count; i++) q[i] = max(a[i], b[i], c[i]);
+    report("per-call max (c11)", now_sec() - start, count);
+    expected = sum_i32(q, count);
+    start = now_sec();
+    max3_many(a, b, c, q, count);
+    report("max3_many", now_sec() - start, count);
+    mismatches += sum_i32(q, count) != expected;
+
+    printf("\n%s\n", mismatches == 0 ? "all versions agree" : "MISMATCH between versions!");
+
+    free(n);
+    free(fact);
+    free(a);
+    free(b);
+    free(c);
+    free(q);
+    free(r);
+    return 0;
+}
@@ -0,0 +1,142 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mmap_array.h"
+
+// MEMORY-MAPPED ARRAY - IMPLEMENTATION
+// ====================================
+// Growing = extend the file with ftruncate, then unmap and map it again
+// (the mapping can't grow in place portably). Capacity doubles, so this
+// is rare - same amortized O(1) push as DynamicArray.
+
+#define MMAP_ARRAY_MAGIC   0x52524144u   // "DARR" in little-endian bytes
+#define MMAP_ARRAY_VERSION 1u
+#define DATA_OFFSET        64            // Header padded to one cache line
+#define MIN_CAPACITY       1024
+
+static int map_file(MmapArray *arr, size_t bytes) {
+    int prot = arr->readonly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *base = mmap(NULL, bytes, prot, MAP_SHARED, arr->fd, 0);
+    if (base == MAP_FAILED) return -1;
+
+    arr->header = base;
+    arr->data = (int32_t*)((char*)base + DATA_OFFSET);
+    arr->map_bytes = bytes;
+    arr->capacity = (bytes - DATA_OFFSET) / sizeof(int32_t);
+    return 0;
+}
+
+MmapArray* mmap_array_open(const char *path, int flags) {
+    MmapArray *arr = malloc(sizeof(MmapArray));
+    if (arr == NULL) return NULL;
+    arr->readonly = (flags & MMAP_ARRAY_READONLY) != 0;
+
+    int open_flags = arr->readonly ? O_RDONLY : O_RDWR;
+    if (flags & MMAP_ARRAY_CREATE) open_flags = O_RDWR | O_CREAT | O_TRUNC;
+    arr->readonly = arr->readonly && !(flags & MMAP_ARRAY_CREATE);
+
+    arr->fd = open(path, open_flags, 0644);
+    if (arr->fd < 0) {
+        free(arr);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(arr->fd, &st) != 0) goto fail;
+
+    size_t bytes = (size_t)st.st_size;
+    if (bytes == 0 && !arr->readonly) {
+        // New file: write a header and room for MIN_CAPACITY elements
+        bytes = DATA_OFFSET + MIN_CAPACITY * sizeof(int32_t);
+        if (ftruncate(arr->fd, (off_t)bytes) != 0) goto fail;
+        if (map_file(arr, bytes) != 0) goto fail;
+        arr->header->magic = MMAP_ARRAY_MAGIC;
+        arr->header->version = MMAP_ARRAY_VERSION;
+        arr->header->elem_size = sizeof(int32_t);
+        arr->header->size = 0;
+        return arr;
+    }
+
+    if (bytes < DATA_OFFSET) goto fail;
+    if (map_file(arr, bytes) != 0) goto fail;
+
+    // Existing file: check it really is one of ours before trusting `size`
+    const MmapArrayHeader *h = arr->header;
+    if (h->magic != MMAP_ARRAY_MAGIC || h->version != MMAP_ARRAY_VERSION ||
+        h->elem_size != sizeof(int32_t) || h->size > arr->capacity) {
+        munmap(arr->header, arr->map_bytes);
+        goto fail;
+    }
+    return arr;
+
+fail:
+    close(arr->fd);
+    free(arr);
+    return NULL;
+}
+
+int mmap_array_close(MmapArray *arr) {
+    if (arr == NULL) return 0;
+    int result = 0;
+    size_t used = DATA_OFFSET + mmap_array_size(arr) * sizeof(int32_t);
+
+    if (munmap(arr->header, arr->map_bytes) != 0) result = -1;
+    // Drop the unused tail so the file is exactly header + data
+    if (!arr->readonly && ftruncate(arr->fd, (off_t)used) != 0) result = -1;
+    if (close(arr->fd) != 0) result = -1;
+    free(arr);
+    return result;
+}
+
+int mmap_array_reserve(MmapArray *arr, size_t min_capacity) {
+    if (arr->readonly) return -1;
+    if (min_capacity <= arr->capacity) return 0;
+    if (min_capacity > (SIZE_MAX - DATA_OFFSET) / sizeof(int32_t)) return -1;
+
+    size_t bytes = DATA_OFFSET + min_capacity * sizeof(int32_t);
+    if (ftruncate(arr->fd, (off_t)bytes) != 0) return -1;
+
+    MmapArrayHeader *old = arr->header;
+    size_t old_bytes = arr->map_bytes;
+    if (map_file(arr, bytes) != 0) return -1;  // Old mapping untouched on failure
+    munmap(old, old_bytes);
+    return 0;
+}
+
+static int ensure_room(MmapArray *arr, size_t extra) {
+    if (extra > SIZE_MAX - mmap_array_size(arr)) return -1;
+    size_t needed = mmap_array_size(arr) + extra;
+    if (needed <= arr->capacity) return 0;
+    size_t cap = arr->capacity < MIN_CAPACITY ? MIN_CAPACITY : arr->capacity * 2;
+    return mmap_array_reserve(arr, cap < needed ? needed : cap);
+}
+
+int mmap_array_push(MmapArray *arr, int32_t value) {
+    if (arr->readonly || ensure_room(arr, 1) != 0) return -1;
+    arr->data[arr->header->size++] = value;
+    return 0;
+}
+
+int mmap_array_push_n(MmapArray *arr, const int32_t *values, size_t count) {
+    if (arr->readonly || ensure_room(arr, count) != 0) return -1;
+    memcpy(arr->data + arr->header->size, values, count * sizeof(int32_t));
+    arr->header->size += count;
+    return 0;
+}
+
+int mmap_array_pop(MmapArray *arr, int32_t *out) {
+    if (arr->readonly || arr->header->size == 0) return -1;
+    arr->header->size--;
+    if (out != NULL) *out = arr->data[arr->header->size];
+    return 0;
+}
+
+int mmap_array_flush(MmapArray *arr) {
+    if (arr->readonly) return 0;
+    return msync(arr->header, arr->map_bytes, MS_SYNC);
+}
@@ -0,0 +1,74 @@
+#ifndef MMAP_ARRAY_H
+#define MMAP_ARRAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// MEMORY-MAPPED PERSISTENT INT ARRAY
+// ==================================
+// Same push/pop idea as DynamicArray (efficient_dynamic_array.c), but the
+// storage IS a file: mmap() maps the file into memory, so writing data[i]
+// writes the file - no fprintf/fgets, no parsing
+//
+// - Grows by extending the file (ftruncate) and re-mapping it
+// - Can be bigger than RAM: the OS pages parts in and out on demand
+// - Reopening is instant: nothing is read until you touch it
+// - Many processes can open the same file read-only and share the pages
+//
+// File layout: 64-byte header (magic, version, element count) then the ints
+//
+// Usage:
+//   MmapArray *arr = mmap_array_open("numbers.dat", MMAP_ARRAY_CREATE);
+//   mmap_array_push(arr, 42);
+//   mmap_array_flush(arr);   // msync: force dirty pages to disk now
+//   mmap_array_close(arr);
+//
+// Build: gcc -O2 -o program your_file.c mmap_array.c   (POSIX only)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Flags for mmap_array_open
+#define MMAP_ARRAY_CREATE    1   // Create the file, or empty an existing one
+#define MMAP_ARRAY_READONLY  2   // Map read-only (push/pop fail); safe to share
+
+typedef struct {
+    uint32_t magic;       // MMAP_ARRAY_MAGIC
+    uint32_t version;
+    uint32_t elem_size;   // sizeof(int32_t)
+    uint32_t reserved;
+    uint64_t size;        // Number of elements in use
+} MmapArrayHeader;
+
+typedef struct {
+    int fd;
+    int readonly;
+    MmapArrayHeader *header;  // Start of the mapping
+    int32_t *data;            // Elements, right after the header
+    size_t capacity;          // Elements that fit in the current mapping
+    size_t map_bytes;         // Length of the mapping (= file size)
+} MmapArray;
+
+// Returns NULL on failure (missing file, not an array file, mmap failed)
+MmapArray* mmap_array_open(const char *path, int flags);
+
+// Writable arrays trim the file to its used size, then everything is unmapped
+int mmap_array_close(MmapArray *arr);
+
+// 0 = success, -1 = failure (read-only, empty, or the file couldn't grow)
+int mmap_array_reserve(MmapArray *arr, size_t min_capacity);
+int mmap_array_push(MmapArray *arr, int32_t value);
+int mmap_array_push_n(MmapArray *arr, const int32_t *values, size_t count);
+int mmap_array_pop(MmapArray *arr, int32_t *out);   // out may be NULL
+int mmap_array_flush(MmapArray *arr);               // msync(MS_SYNC)
+
+static inline size_t mmap_array_size(const MmapArray *arr) {
+    return (size_t)arr->header->size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,122 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mmap_array.h"
+
+// MMAP ARRAY COLD-START BENCHMARK
+// ===============================
+// How long until a program that starts up can use N ints saved by a previous run?
+// 1. mmap_array_open + sum every element (pages loaded on demand)
+// 2. Text file read back line by line with fgets + strtol (as in c12_files.c)
+//
+// Before each measurement the file's pages are dropped from the OS cache
+// (posix_fadvise DONTNEED, where supported) so the read really hits the disk
+//
+// Build: gcc -O2 -o program mmap_array_bench.c mmap_array.c && ./program [count]
+
+#define ARRAY_FILE "bench_numbers.dat"
+#define TEXT_FILE  "bench_numbers.txt"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Best effort: flush the file and ask the OS to forget its cached pages
+static void drop_cache(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+#ifdef POSIX_FADV_DONTNEED
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    close(fd);
+}
+
+static int32_t value_at(size_t i) {
+    return (int32_t)(i * 2654435761u);
+}
+
+static void write_files(size_t count) {
+    MmapArray *arr = mmap_array_open(ARRAY_FILE, MMAP_ARRAY_CREATE);
+    FILE *text = fopen(TEXT_FILE, "w");
+    if (arr == NULL || text == NULL) {
+        printf("Error creating benchmark files\n");
+        exit(1);
+    }
+
+    double start = now_sec();
+    for (size_t i = 0; i < count; i++) mmap_array_push(arr, value_at(i));
+    mmap_array_flush(arr);
+    double mmap_write = now_sec() - start;
+    mmap_array_close(arr);
+
+    start = now_sec();
+    for (size_t i = 0; i < count; i++) fprintf(text, "%d\n", value_at(i));
+    fclose(text);
+    double text_write = now_sec() - start;
+
+    printf("write  mmap push + msync %9.2f ms   fprintf %9.2f ms\n", mmap_write * 1e3, text_write * 1e3);
+}
+
+static void read_mmap(size_t count) {
+    drop_cache(ARRAY_FILE);
+
+    double start = now_sec();
+    MmapArray *arr = mmap_array_open(ARRAY_FILE, MMAP_ARRAY_READONLY);
+    double opened = now_sec() - start;
+    if (arr == NULL || mmap_array_size(arr) != count) {
+        printf("Error reopening %s\n", ARRAY_FILE);
+        exit(1);
+    }
+
+    long long sum = 0;
+    size_t n = mmap_array_size(arr);
+    for (size_t i = 0; i < n; i++) sum += arr->data[i];
+    double total = now_sec() - start;
+    mmap_array_close(arr);
+
+    printf("read   mmap   open %8.3f ms  open+scan %9.2f ms  (sum %lld)\n", opened * 1e3, total * 1e3, sum);
+}
+
+static void read_text(size_t count) {
+    drop_cache(TEXT_FILE);
+
+    double start = now_sec();
+    FILE *file = fopen(TEXT_FILE, "r");
+    if (file == NULL) {
+        printf("Error opening %s\n", TEXT_FILE);
+        exit(1);
+    }
+
+    char buffer[100];
+    long long sum = 0;
+    size_t lines = 0;
+    while (fgets(buffer, sizeof(buffer), file) != NULL) {
+        sum += strtol(buffer, NULL, 10);
+        lines++;
+    }
+    fclose(file);
+    double total = now_sec() - start;
+
+    printf("read   fgets  %zu lines          total %9.2f ms  (sum %lld)\n", lines, total * 1e3, sum);
+    if (lines != count) printf("  warning: expected %zu lines\n", count);
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 50000000;
+
+    printf("%zu ints\n", count);
+    write_files(count);
+    read_mmap(count);
+    read_text(count);
+
+    remove(ARRAY_FILE);
+    remove(TEXT_FILE);
+    return 0;
+}
@@ -0,0 +1,281 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "multi_match.h"
+
+// AHO-CORASICK - IMPLEMENTATION
+// =============================
+// Build:
+// 1. Give every byte used by a pattern its own class (1..), all others class 0
+// 2. Insert the patterns into a trie stored directly in the DFA table
+// 3. Breadth-first pass: compute failure links and fill every missing
+//    transition with the failure state's transition -> a complete DFA
+// 4. Store each entry as "row offset" (state * classes) so scanning is just
+//    row = table[row + class] with no multiply in the loop. The top bit of an
+//    entry is set when the target state ends a pattern (one test per byte)
+// 5. Prefilter: the bytes that start a pattern. Up to 4 of them are compared
+//    directly (SSE2); more become two 16-byte tables for an SSSE3 nibble lookup
+
+#if defined(__SSE2__)
+#define MM_SSE2 1           // Always on x86-64: no runtime check needed
+#include <immintrin.h>
+#endif
+
+#define PREFILTER_FEW 4     // Up to this many first bytes: one compare each
+#define NO_PATTERN    (-1)
+#define HAS_OUTPUT    0x80000000u
+
+typedef enum {
+    PREFILTER_NONE,         // No SIMD, or every byte starts a pattern
+    PREFILTER_BYTES,        // SSE2 compares against each first byte
+    PREFILTER_SET           // SSSE3 nibble lookup (if the CPU has it), any number of first bytes
+} PrefilterKind;
+
+struct MultiMatch {
+    uint8_t class_of[256];
+    size_t classes;
+    size_t states;
+    uint32_t *table;        // states x classes, entries are row offsets (| HAS_OUTPUT)
+    int32_t *first_pattern; // Per state: a pattern ending exactly here, or NO_PATTERN
+    uint32_t *suffix_output;// Per state: nearest shorter suffix state with patterns, 0 = none
+    int32_t *same_next;     // Per pattern: next pattern ending at the same state
+    size_t *lens;           // Per pattern: length (to turn an end position into a start)
+    PrefilterKind prefilter;
+    int first_count;        // PREFILTER_BYTES: how many of first_bytes
+    unsigned char first_bytes[PREFILTER_FEW];
+    // PREFILTER_SET: first_rows[h >> 3][lo] bit (h & 7) is set if byte (h << 4 | lo) starts a pattern
+    unsigned char first_rows[2][16];
+};
+
+void multi_match_free(MultiMatch *mm) {
+    if (mm == NULL) return;
+    free(mm->table);
+    free(mm->first_pattern);
+    free(mm->suffix_output);
+    free(mm->same_next);
+    free(mm->lens);
+    free(mm);
+}
+
+// The state itself if a pattern ends there, else its nearest suffix that has one
+static uint32_t output_state(const MultiMatch *mm, uint32_t state) {
+    return mm->first_pattern[state] != NO_PATTERN ? state : mm->suffix_output[state];
+}
+
+// ===== BUILD =====
+
+static void build_classes(MultiMatch *mm, const char *const *patterns, const size_t *lens, size_t count) {
+    unsigned char used[256] = {0};
+    for (size_t p = 0; p < count; p++) {
+        for (size_t i = 0; i < lens[p]; i++) used[(unsigned char)patterns[p][i]] = 1;
+    }
+    mm->classes = 1;  // Class 0 = "byte not in any pattern"
+    for (int b = 0; b < 256; b++) {
+        mm->class_of[b] = used[b] ? (uint8_t)mm->classes++ : 0;
+    }
+}
+
+static void build_prefilter(MultiMatch *mm, const char *const *patterns, size_t count) {
+    unsigned char seen[256] = {0};
+    int distinct = 0;
+    for (size_t p = 0; p < count; p++) {
+        unsigned char b = (unsigned char)patterns[p][0];
+        if (seen[b]) continue;
+        seen[b] = 1;
+        if (distinct < PREFILTER_FEW) mm->first_bytes[distinct] = b;
+        distinct++;
+        mm->first_rows[b >> 7][b & 15] |= (unsigned char)(1u << ((b >> 4) & 7));
+    }
+    mm->first_count = distinct;
+    mm->prefilter = PREFILTER_NONE;
+#ifdef MM_SSE2
+    if (distinct <= PREFILTER_FEW) {
+        mm->prefilter = PREFILTER_BYTES;
+    } else if (distinct < 256 && __builtin_cpu_supports("ssse3")) {
+        mm->prefilter = PREFILTER_SET;
+    }
+#endif
+}
+
+MultiMatch* multi_match_build(const char *const *patterns, const size_t *lens, size_t count) {
+    if (count == 0 || count > INT32_MAX) return NULL;
+
+    size_t max_states = 1;  // Root + at most one state per pattern byte
+    for (size_t p = 0; p < count; p++) {
+        if (lens[p] == 0 || lens[p] > SIZE_MAX - max_states) return NULL;
+        max_states += lens[p];
+    }
+
+    MultiMatch *mm = calloc(1, sizeof(MultiMatch));
+    if (mm == NULL) return NULL;
+    build_classes(mm, patterns, lens, count);
+    size_t classes = mm->classes;
+    if (max_states > (HAS_OUTPUT - 1) / classes) {  // Row offsets must fit below the flag bit
+        free(mm);
+        return NULL;
+    }
+
+    mm->table = calloc(max_states * classes, sizeof(uint32_t));  // 0 = root / "no child yet"
+    mm->first_pattern = malloc(max_states * sizeof(int32_t));
+    mm->suffix_output = calloc(max_states, sizeof(uint32_t));
+    mm->same_next = malloc(count * sizeof(int32_t));
+    mm->lens = malloc(count * sizeof(size_t));
+    uint32_t *fail = malloc(max_states * sizeof(uint32_t));
+    uint32_t *queue = malloc(max_states * sizeof(uint32_t));
+    if (mm->table == NULL || mm->first_pattern == NULL || mm->suffix_output == NULL ||
+        mm->same_next == NULL || mm->lens == NULL || fail == NULL || queue == NULL) {
+        free(fail);
+        free(queue);
+        multi_match_free(mm);
+        return NULL;
+    }
+    for (size_t s = 0; s < max_states; s++) mm->first_pattern[s] = NO_PATTERN;
+    uint32_t *table = mm->table;
+
+    // 2. Trie
+    uint32_t states = 1;
+    for (size_t p = 0; p < count; p++) {
+        uint32_t s = 0;
+        for (size_t i = 0; i < lens[p]; i++) {
+            uint32_t *edge = &table[s * classes + mm->class_of[(unsigned char)patterns[p][i]]];
+            if (*edge == 0) *edge = states++;
+            s = *edge;
+        }
+        mm->same_next[p] = mm->first_pattern[s];  // Duplicates chain at the same state
+        mm->first_pattern[s] = (int32_t)p;
+        mm->lens[p] = lens[p];
+    }
+    mm->states = states;
+
+    // 3. Failure links, breadth-first so a state's failure state is always finished first
+    size_t head = 0, tail = 0;
+    for (size_t c = 0; c < classes; c++) {
+        uint32_t child = table[c];
+        if (child != 0) {  // Root's missing edges stay 0 = "back to root"
+            fail[child] = 0;
+            queue[tail++] = child;
+        }
+    }
+    while (head < tail) {
+        uint32_t s = queue[head++];
+        uint32_t *row = &table[(size_t)s * classes];
+        const uint32_t *fail_row = &table[(size_t)fail[s] * classes];
+        for (size_t c = 0; c < classes; c++) {
+            uint32_t child = row[c];
+            if (child != 0) {
+                fail[child] = fail_row[c];
+                mm->suffix_output[child] = output_state(mm, fail[child]);
+                queue[tail++] = child;
+            } else {
+                row[c] = fail_row[c];  // No edge: go where the failure state would go
+            }
+        }
+    }
+    free(fail);
+    free(queue);
+
+    // 4. State ids -> row offsets + output flag, and give back the unused tail of the table
+    for (size_t i = 0; i < (size_t)states * classes; i++) {
+        uint32_t target = table[i];
+        table[i] = target * (uint32_t)classes | (output_state(mm, target) != 0 ? HAS_OUTPUT : 0);
+    }
+    uint32_t *shrunk = realloc(table, (size_t)states * classes * sizeof(uint32_t));
+    if (shrunk != NULL) mm->table = shrunk;
+
+    build_prefilter(mm, patterns, count);
+    return mm;
+}
+
+size_t multi_match_states(const MultiMatch *mm) {
+    return mm->states;
+}
+
+size_t multi_match_classes(const MultiMatch *mm) {
+    return mm->classes;
+}
+
+// ===== SCAN =====
+
+#ifdef MM_SSE2
+// SSSE3 code in this file without compiling everything with -mssse3 (see simd_kernels.c)
+#define SSSE3 __attribute__((target("ssse3")))
+
+// Index of the first byte at or after pos that can start a pattern
+// (only whole 16-byte blocks are checked; the byte loop handles the tail)
+static size_t skip_to_bytes(const MultiMatch *mm, const unsigned char *text, size_t pos, size_t len) {
+    __m128i wanted[PREFILTER_FEW];
+    for (int k = 0; k < mm->first_count; k++) wanted[k] = _mm_set1_epi8((char)mm->first_bytes[k]);
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + pos));
+        __m128i hit = _mm_cmpeq_epi8(block, wanted[0]);
+        for (int k = 1; k < mm->first_count; k++) {
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(block, wanted[k]));
+        }
+        unsigned mask = (unsigned)_mm_movemask_epi8(hit);
+        if (mask != 0) return pos + (unsigned)__builtin_ctz(mask);
+    }
+    return pos;
+}
+
+// The same for any set of first bytes: _mm_shuffle_epi8 (pshufb) is a 16-entry
+// table lookup, so each byte's LOW nibble picks its row of first_rows and its
+// HIGH nibble picks the bit in that row - 16 set tests at once
+SSSE3 static size_t skip_to_set(const MultiMatch *mm, const unsigned char *text, size_t pos, size_t len) {
+    const __m128i rows_low = _mm_loadu_si128((const __m128i*)mm->first_rows[0]);   // High nibble 0-7
+    const __m128i rows_high = _mm_loadu_si128((const __m128i*)mm->first_rows[1]);  // High nibble 8-15
+    const __m128i bit_of = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i top = _mm_set1_epi8((char)0x80);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + pos));
+        __m128i lo = _mm_and_si128(block, nibble);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(block, 4), nibble);
+        // pshufb returns 0 where the index has its top bit set: each byte reads
+        // one table and gets 0 from the other
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(hi, _mm_set1_epi8(7)), top);
+        __m128i row = _mm_or_si128(_mm_shuffle_epi8(rows_low, _mm_or_si128(lo, upper)),
+                                   _mm_shuffle_epi8(rows_high, _mm_or_si128(lo, _mm_xor_si128(upper, top))));
+        __m128i miss = _mm_cmpeq_epi8(_mm_and_si128(row, _mm_shuffle_epi8(bit_of, hi)), zero);
+        unsigned mask = ~(unsigned)_mm_movemask_epi8(miss) & 0xFFFF;
+        if (mask != 0) return pos + (unsigned)__builtin_ctz(mask);
+    }
+    return pos;
+}
+#endif
+
+size_t multi_match_scan(const MultiMatch *mm, const char *text, size_t len,
+                        MatchCallback on_match, void *user) {
+    const unsigned char *bytes = (const unsigned char*)text;
+    const uint32_t *table = mm->table;
+    const size_t classes = mm->classes;
+    uint32_t row = 0;
+    size_t found = 0;
+
+    for (size_t pos = 0; pos < len; pos++) {
+#ifdef MM_SSE2
+        if (row == 0 && mm->prefilter != PREFILTER_NONE) {
+            // At the root nothing can match until a pattern's first byte shows up
+            pos = mm->prefilter == PREFILTER_BYTES ? skip_to_bytes(mm, bytes, pos, len)
+                                                   : skip_to_set(mm, bytes, pos, len);
+            if (pos >= len) break;
+        }
+#endif
+        uint32_t entry = table[row + mm->class_of[bytes[pos]]];
+        row = entry & ~HAS_OUTPUT;
+        if ((entry & HAS_OUTPUT) == 0) continue;
+
+        // Every pattern ending at pos, longest first
+        for (uint32_t state = output_state(mm, row / (uint32_t)classes); state != 0;
+             state = mm->suffix_output[state]) {
+            for (int32_t p = mm->first_pattern[state]; p != NO_PATTERN; p = mm->same_next[p]) {
+                found++;
+                if (on_match != NULL && on_match((size_t)p, pos + 1 - mm->lens[p], user) != 0) return found;
+            }
+        }
+    }
+    return found;
+}
@@ -0,0 +1,58 @@
+#ifndef MULTI_MATCH_H
+#define MULTI_MATCH_H
+
+#include <stddef.h>
+
+// MULTI-PATTERN SEARCH (AHO-CORASICK)
+// ===================================
+// c03_strings.c finds ONE pattern with strstr. Searching for K keywords that
+// way means K passes over the text -> O(K * n).
+//
+// Aho-Corasick compiles all keywords into one state machine (a DFA):
+// - Each state = "the longest keyword prefix that the text currently ends with"
+// - Each input byte = ONE table lookup to the next state  -> O(n) for any K
+// - States that complete a keyword report it (overlapping matches included)
+//
+// Size tricks:
+// - Bytes that never appear in a keyword all share one column ("byte classes"),
+//   so the table is states x classes instead of states x 256
+// - Between matches the scanner skips 16 bytes at a time (SSSE3 on x86, when
+//   the CPU has it) until a byte that starts some keyword appears. Any number of
+//   keywords works; it pays off when their first bytes are rare in the text
+//   (ERROR/FATAL in log lines, capitalized names in lowercase prose)
+//
+//   const char *words[] = { "ERROR", "WARN", "timeout" };
+//   size_t lens[] = { 5, 4, 7 };
+//   MultiMatch *mm = multi_match_build(words, lens, 3);
+//   multi_match_scan(mm, text, text_len, on_match, NULL);
+//   multi_match_free(mm);
+//
+// Build: gcc -O2 -o program your_file.c multi_match.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called for every match: which pattern (its index in the build arrays) and
+// where in the text it starts. Return non-zero to stop the scan early.
+typedef int (*MatchCallback)(size_t pattern, size_t offset, void *user);
+
+typedef struct MultiMatch MultiMatch;
+
+// Compile the patterns (copied - the arrays can be freed afterwards)
+// NULL if out of memory or a pattern is empty
+MultiMatch* multi_match_build(const char *const *patterns, const size_t *lens, size_t count);
+void multi_match_free(MultiMatch *mm);
+
+// One pass over text; returns the number of matches reported
+size_t multi_match_scan(const MultiMatch *mm, const char *text, size_t len,
+                        MatchCallback on_match, void *user);
+
+size_t multi_match_states(const MultiMatch *mm);   // For sizing / curiosity
+size_t multi_match_classes(const MultiMatch *mm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
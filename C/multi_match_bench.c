@@ -0,0 +1,141 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "multi_match.h"
+
+// MULTI-PATTERN SEARCH BENCHMARK
+// ==============================
+// Counts every (overlapping) occurrence of K keywords in a text:
+// 1. strstr loop: one full pass over the text PER keyword (c03_strings.c style)
+// 2. MultiMatch: one pass total
+//
+// Case A: K random words (default 1000) in 8 MiB of text built from a 5000-word vocabulary
+//         (keywords start with every letter -> the prefilter can't skip anything)
+// Case B: the same K words capitalized (26 first bytes) in 8 MiB of mostly lowercase text
+// Case C: 3 keywords in 64 MiB of log lines (first bytes E/F/P are rare -> prefilter skips)
+//
+// Build: gcc -O2 -o program multi_match_bench.c multi_match.c && ./program [keywords]
+
+#define VOCAB 5000
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned seed = 42;
+static unsigned next_random(void) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 16;
+}
+
+static size_t count_strstr(const char *text, char **patterns, size_t count) {
+    size_t found = 0;
+    for (size_t p = 0; p < count; p++) {
+        for (const char *hit = strstr(text, patterns[p]); hit != NULL; hit = strstr(hit + 1, patterns[p])) {
+            found++;
+        }
+    }
+    return found;
+}
+
+static void compare(const char *name, const char *text, size_t len, char **patterns, size_t count) {
+    size_t *lens = malloc(count * sizeof(size_t));
+    for (size_t p = 0; p < count; p++) lens[p] = strlen(patterns[p]);
+
+    double start = now_sec();
+    size_t found_strstr = count_strstr(text, patterns, count);
+    double strstr_time = now_sec() - start;
+
+    start = now_sec();
+    MultiMatch *mm = multi_match_build((const char *const *)patterns, lens, count);
+    double build_time = now_sec() - start;
+
+    start = now_sec();
+    size_t found_mm = multi_match_scan(mm, text, len, NULL, NULL);
+    double scan_time = now_sec() - start;
+
+    printf("%s: %zu keywords, %zu MiB, %zu matches%s\n", name, count, len >> 20, found_mm,
+           found_mm == found_strstr ? "" : "  MISMATCH!");
+    printf("  strstr loop  %10.1f ms  (%7.1f MB/s)\n", strstr_time * 1e3, len / strstr_time / 1e6);
+    printf("  MultiMatch   %10.1f ms  (%7.1f MB/s)  + build %.2f ms, %zu states x %zu classes\n\n",
+           scan_time * 1e3, len / scan_time / 1e6, build_time * 1e3,
+           multi_match_states(mm), multi_match_classes(mm));
+
+    multi_match_free(mm);
+    free(lens);
+}
+
+// 8 MiB of random vocabulary words; 1 in `capital_every` is capitalized (0 = none)
+static char* vocab_text(char **vocab, size_t capital_every, size_t *out_len) {
+    size_t cap = 8 << 20;
+    char *text = malloc(cap + 16);
+    size_t len = 0;
+    while (len < cap) {
+        const char *word = vocab[next_random() % VOCAB];
+        size_t n = strlen(word);
+        memcpy(text + len, word, n);
+        if (capital_every != 0 && next_random() % capital_every == 0) text[len] -= 'a' - 'A';
+        len += n;
+        text[len++] = ' ';
+    }
+    text[len] = '\0';
+    *out_len = len;
+    return text;
+}
+
+static void case_keywords(size_t keywords) {
+    char **vocab = malloc(VOCAB * sizeof(char*));
+    for (size_t i = 0; i < VOCAB; i++) {
+        size_t len = 4 + next_random() % 7;
+        vocab[i] = malloc(len + 1);
+        for (size_t j = 0; j < len; j++) vocab[i][j] = (char)('a' + next_random() % 26);
+        vocab[i][len] = '\0';
+    }
+    if (keywords > VOCAB) keywords = VOCAB;
+
+    size_t len;
+    char *text = vocab_text(vocab, 0, &len);
+    compare("A. keyword list", text, len, vocab, keywords);
+    free(text);
+
+    // B: the same keywords, capitalized, looked for in text where few words are
+    text = vocab_text(vocab, 50, &len);
+    for (size_t i = 0; i < keywords; i++) vocab[i][0] -= 'a' - 'A';
+    compare("B. capitalized names", text, len, vocab, keywords);
+    free(text);
+
+    for (size_t i = 0; i < VOCAB; i++) free(vocab[i]);
+    free(vocab);
+}
+
+static void case_log(void) {
+    static const char *levels[] = { "INFO", "INFO", "INFO", "DEBUG", "WARN" };
+    size_t cap = 64 << 20;
+    char *text = malloc(cap + 128);
+    size_t len = 0;
+    for (size_t i = 0; len < cap; i++) {
+        // About 1 line in 5000 is an error
+        const char *level = next_random() % 5000 == 0 ? "ERROR" : levels[next_random() % 5];
+        len += (size_t)snprintf(text + len, 128, "2024-05-01T12:%02zu:%02zu %s request handled id=%zu status=200\n",
+                                (i / 60) % 60, i % 60, level, i);
+    }
+    text[len] = '\0';
+
+    char *patterns[] = { "ERROR", "FATAL", "PANIC" };
+    compare("C. log levels", text, len, patterns, 3);
+    free(text);
+}
+
+int main(int argc, char *argv[]) {
+    size_t keywords = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000;
+    if (keywords == 0) keywords = 1;
+
+    case_keywords(keywords);
+    case_log();
+    return 0;
+}
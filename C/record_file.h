@@ -0,0 +1,106 @@
+#ifndef RECORD_FILE_H
+#define RECORD_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "records.h"
+
+// BINARY RECORD FILES (ZERO-COPY LOAD)
+// ====================================
+// c12_files.c saves records as text with fprintf and reads them back with
+// fscanf: every load re-parses every number and copies every string.
+//
+// A record file stores the structs from records.h EXACTLY as they sit in
+// memory, so loading is just mmap(): the file's bytes ARE the array.
+//
+// File layout:
+//   [ 64-byte header ][ record 0 ][ record 1 ] ... [ record count-1 ]
+//
+// - Header: magic, format version, record type + size, count, CRC32 of the
+//   header and of the records
+// - Records start at byte 64: mmap returns page-aligned memory, so every
+//   record is correctly aligned for its type (and the first is cache-line aligned)
+// - Unused name bytes and struct padding are written as zeros, so the same
+//   records always produce the same file (and no stray memory leaks into it)
+// - The header is written LAST: a crashed/partial write is rejected on open
+// - Files are only portable between machines with the same endianness and
+//   struct layout (checked on open via an endian marker and the record size)
+//
+//   RecordWriter *w = record_writer_open("cars.rec", RECORD_CAR);
+//   record_writer_add(w, &car);                 // Buffered, written in 1 MiB batches
+//   record_writer_close(w);                     // Flush + write the header
+//
+//   RecordFile *f = record_file_open("cars.rec", RECORD_CAR, 0);
+//   const Car *cars = record_file_records(f);   // No parsing, no copying
+//   for (size_t i = 0; i < f->count; i++) printf("%s\n", cars[i].brand);
+//   record_file_close(f);
+//
+// Build: gcc -O2 -o program your_file.c record_file.c   (POSIX only)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RECORD_FILE_VERSION 1u
+
+typedef enum {
+    RECORD_PERSON = 1,      // struct Person
+    RECORD_CAR = 2,         // Car
+    RECORD_EMPLOYEE = 3     // Employee
+} RecordType;
+
+// Flags for record_file_open
+#define RECORD_FILE_VERIFY 1   // Also check the records' CRC32 (reads the whole file)
+
+typedef struct {
+    uint32_t magic;         // "RECF"
+    uint16_t version;       // RECORD_FILE_VERSION
+    uint16_t header_size;   // 64 = where the records start
+    uint32_t endian;        // 0x01020304 as written by this machine
+    uint32_t record_type;   // RecordType
+    uint32_t record_size;   // sizeof the struct
+    uint32_t data_crc;      // CRC32 of all record bytes
+    uint64_t count;
+    uint8_t reserved[28];
+    uint32_t header_crc;    // CRC32 of the 60 bytes above
+} RecordFileHeader;
+
+typedef struct {
+    int fd;
+    void *base;             // The whole file, mapped read-only
+    size_t map_bytes;
+    const RecordFileHeader *header;
+    RecordType type;
+    size_t count;
+} RecordFile;
+
+typedef struct RecordWriter RecordWriter;
+
+size_t record_size(RecordType type);    // 0 for an unknown type
+uint32_t record_crc32(uint32_t crc, const void *data, size_t len);  // Start with crc = 0
+
+// ===== WRITE =====
+
+RecordWriter* record_writer_open(const char *path, RecordType type);   // Creates/truncates; NULL on failure
+int record_writer_add(RecordWriter *w, const void *record);             // 0 = success, -1 = write error
+int record_writer_add_n(RecordWriter *w, const void *records, size_t count);
+int record_writer_close(RecordWriter *w);   // 0 only if every record and the header reached the file
+
+// ===== READ =====
+
+// NULL if the file is missing, truncated, corrupt, of another type, or
+// from a machine with a different layout
+RecordFile* record_file_open(const char *path, RecordType type, int flags);
+void record_file_close(RecordFile *f);
+
+// Pointer to record 0 inside the mapping - cast to const Car* etc.
+static inline const void* record_file_records(const RecordFile *f) {
+    return (const char*)f->base + f->header->header_size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,169 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "record_file.h"
+
+// RECORD FILE BENCHMARK
+// =====================
+// Saves N Car records (default 10 million) and loads them back:
+// 1. Text: fprintf one line per car, fscanf them back into a Car array (c12_files.c style)
+// 2. Record file: RecordWriter, then record_file_open = mmap, no parsing
+//
+// "Load" = until the program can read every car; for the record file that
+// includes touching every record once (summing the years), so page faults
+// are counted too. Cold = the file's pages were dropped from the OS cache first.
+//
+// Build: gcc -O2 -o program record_file_bench.c record_file.c && ./program [records]
+
+#define TEXT_FILE   "bench_cars.txt"
+#define RECORD_FILE "bench_cars.rec"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Best effort: flush the file and ask the OS to forget its cached pages
+static void drop_cache(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+#ifdef POSIX_FADV_DONTNEED
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    close(fd);
+}
+
+static const char *brands[] = { "Toyota", "Honda", "Ford", "Tesla", "BMW", "Mercedes", "Kia", "Volvo" };
+static const char *models[] = { "Camry", "Civic", "Mustang", "Model3", "X5", "C300", "Soul", "XC90" };
+
+static void make_car(Car *car, size_t i) {
+    strcpy(car->brand, brands[i % 8]);
+    strcpy(car->model, models[(i / 8) % 8]);
+    car->year = 1990 + (int)(i % 35);
+}
+
+static long long sum_years(const Car *cars, size_t count) {
+    long long sum = 0;
+    for (size_t i = 0; i < count; i++) sum += cars[i].year;
+    return sum;
+}
+
+// ===== TEXT =====
+
+static void write_text(size_t count) {
+    FILE *file = fopen(TEXT_FILE, "w");
+    Car car;
+    for (size_t i = 0; i < count; i++) {
+        make_car(&car, i);
+        fprintf(file, "%s %s %d\n", car.brand, car.model, car.year);
+    }
+    fclose(file);
+}
+
+static long long load_text(size_t *count_out) {
+    FILE *file = fopen(TEXT_FILE, "r");
+    size_t count = 0, capacity = 1024;
+    Car *cars = malloc(capacity * sizeof(Car));
+    Car car;
+    while (fscanf(file, "%49s %49s %d", car.brand, car.model, &car.year) == 3) {
+        if (count == capacity) {
+            capacity *= 2;
+            cars = realloc(cars, capacity * sizeof(Car));
+        }
+        cars[count++] = car;
+    }
+    fclose(file);
+    long long sum = sum_years(cars, count);
+    free(cars);
+    *count_out = count;
+    return sum;
+}
+
+// ===== RECORD FILE =====
+
+static int write_records(size_t count) {
+    RecordWriter *w = record_writer_open(RECORD_FILE, RECORD_CAR);
+    if (w == NULL) return -1;
+    Car car;
+    memset(&car, 0, sizeof(car));
+    for (size_t i = 0; i < count; i++) {
+        make_car(&car, i);
+        record_writer_add(w, &car);
+    }
+    return record_writer_close(w);
+}
+
+static long long load_records(int flags, size_t *count_out) {
+    RecordFile *f = record_file_open(RECORD_FILE, RECORD_CAR, flags);
+    if (f == NULL) {
+        *count_out = 0;
+        return -1;
+    }
+    long long sum = sum_years(record_file_records(f), f->count);
+    *count_out = f->count;
+    record_file_close(f);
+    return sum;
+}
+
+// check < 0: nothing was read back
+static void report(const char *name, double seconds, size_t count, long long check) {
+    printf("  %-32s %9.1f ms  %8.1f M records/s", name, seconds * 1e3, count / seconds / 1e6);
+    if (check >= 0) printf("  (sum of years %lld)", check);
+    printf("\n");
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    if (count == 0) count = 1;
+    size_t loaded;
+    long long check;
+
+    printf("%zu cars (%zu bytes each in the record file)\n\n", count, record_size(RECORD_CAR));
+
+    printf("save:\n");
+    double start = now_sec();
+    write_text(count);
+    report("fprintf text", now_sec() - start, count, -1);
+
+    start = now_sec();
+    if (write_records(count) != 0) {
+        printf("record file write failed\n");
+        return 1;
+    }
+    report("RecordWriter (incl. fsync)", now_sec() - start, count, -1);
+
+    printf("\nload (warm cache):\n");
+    start = now_sec();
+    check = load_text(&loaded);
+    report("fscanf text", now_sec() - start, loaded, check);
+
+    start = now_sec();
+    check = load_records(0, &loaded);
+    report("record_file_open + scan", now_sec() - start, loaded, check);
+
+    start = now_sec();
+    check = load_records(RECORD_FILE_VERIFY, &loaded);
+    report("record_file_open VERIFY + scan", now_sec() - start, loaded, check);
+
+    printf("\nload (cold cache):\n");
+    drop_cache(TEXT_FILE);
+    start = now_sec();
+    check = load_text(&loaded);
+    report("fscanf text", now_sec() - start, loaded, check);
+
+    drop_cache(RECORD_FILE);
+    start = now_sec();
+    check = load_records(0, &loaded);
+    report("record_file_open + scan", now_sec() - start, loaded, check);
+
+    remove(TEXT_FILE);
+    remove(RECORD_FILE);
+    return 0;
+}
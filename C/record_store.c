@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "record_store.h"
+
+// COLUMNAR RECORD STORE - IMPLEMENTATION
+// ======================================
+// Every column of a table grows together (same count, same capacity)
+
+#define MIN_CAPACITY 64
+
+RecordStore* record_store_create(void) {
+    RecordStore *store = calloc(1, sizeof(RecordStore));  // All tables empty, all columns NULL
+    if (store == NULL) return NULL;
+    string_pool_init(&store->strings);
+    return store;
+}
+
+void record_store_free(RecordStore *store) {
+    if (store == NULL) return;
+    free(store->people.name);
+    free(store->people.age);
+    free(store->people.height);
+    free(store->cars.brand);
+    free(store->cars.model);
+    free(store->cars.year);
+    free(store->employees.name);
+    free(store->employees.age);
+    free(store->employees.street);
+    free(store->employees.city);
+    free(store->employees.zip_code);
+    string_pool_destroy(&store->strings);
+    free(store);
+}
+
+// ===== GROWTH =====
+
+// New capacity for a table that is full, or 0 if it can't grow
+// (row numbers are uint32_t, so tables stop at UINT32_MAX rows)
+static size_t next_capacity(size_t capacity) {
+    if (capacity >= UINT32_MAX) return 0;
+    size_t next = capacity < MIN_CAPACITY ? MIN_CAPACITY : capacity * 2;
+    return next > UINT32_MAX ? UINT32_MAX : next;
+}
+
+// Resize one column. On failure the column is unchanged (still valid, just not bigger)
+static int grow_column(void **column, size_t capacity, size_t elem_size) {
+    void *data = realloc(*column, capacity * elem_size);
+    if (data == NULL) return -1;
+    *column = data;
+    return 0;
+}
+
+// Chars used in a fixed char[N] field (it may fill all N with no '\0')
+static size_t field_len(const char *field, size_t size) {
+    const char *end = memchr(field, '\0', size);
+    return end != NULL ? (size_t)(end - field) : size;
+}
+
+#define INTERN_FIELD(store, field) string_pool_intern_n(&(store)->strings, (field), field_len((field), sizeof(field)))
+
+// ===== ADD =====
+
+int store_add_person(RecordStore *store, const struct Person *person) {
+    PersonTable *t = &store->people;
+    if (t->count == t->capacity) {
+        size_t cap = next_capacity(t->capacity);
+        if (cap == 0 ||
+            grow_column((void**)&t->name, cap, sizeof(StrRef)) != 0 ||
+            grow_column((void**)&t->age, cap, sizeof(int)) != 0 ||
+            grow_column((void**)&t->height, cap, sizeof(float)) != 0) return -1;
+        t->capacity = cap;
+    }
+
+    StrRef name = INTERN_FIELD(store, person->name);
+    if (name == STR_NONE) return -1;
+    t->name[t->count] = name;
+    t->age[t->count] = person->age;
+    t->height[t->count] = person->height;
+    t->count++;
+    return 0;
+}
+
+int store_add_car(RecordStore *store, const Car *car) {
+    CarTable *t = &store->cars;
+    if (t->count == t->capacity) {
+        size_t cap = next_capacity(t->capacity);
+        if (cap == 0 ||
+            grow_column((void**)&t->brand, cap, sizeof(StrRef)) != 0 ||
+            grow_column((void**)&t->model, cap, sizeof(StrRef)) != 0 ||
+            grow_column((void**)&t->year, cap, sizeof(int)) != 0) return -1;
+        t->capacity = cap;
+    }
+
+    StrRef brand = INTERN_FIELD(store, car->brand);
+    StrRef model = INTERN_FIELD(store, car->model);
+    if (brand == STR_NONE || model == STR_NONE) return -1;
+    t->brand[t->count] = brand;
+    t->model[t->count] = model;
+    t->year[t->count] = car->year;
+    t->count++;
+    return 0;
+}
+
+int store_add_employee(RecordStore *store, const Employee *employee) {
+    EmployeeTable *t = &store->employees;
+    if (t->count == t->capacity) {
+        size_t cap = next_capacity(t->capacity);
+        if (cap == 0 ||
+            grow_column((void**)&t->name, cap, sizeof(StrRef)) != 0 ||
+            grow_column((void**)&t->age, cap, sizeof(int)) != 0 ||
+            grow_column((void**)&t->street, cap, sizeof(StrRef)) != 0 ||
+            grow_column((void**)&t->city, cap, sizeof(StrRef)) != 0 ||
+            grow_column((void**)&t->zip_code, cap, sizeof(int)) != 0) return -1;
+        t->capacity = cap;
+    }
+
+    StrRef name = INTERN_FIELD(store, employee->name);
+    StrRef street = INTERN_FIELD(store, employee->address.street);
+    StrRef city = INTERN_FIELD(store, employee->address.city);
+    if (name == STR_NONE || street == STR_NONE || city == STR_NONE) return -1;
+    t->name[t->count] = name;
+    t->age[t->count] = employee->age;
+    t->street[t->count] = street;
+    t->city[t->count] = city;
+    t->zip_code[t->count] = employee->address.zipCode;
+    t->count++;
+    return 0;
+}
+
+// ===== GET =====
+
+static void copy_field(char *dest, size_t size, const StringPool *pool, StrRef ref) {
+    snprintf(dest, size, "%s", string_pool_get(pool, ref));  // Truncates safely
+}
+
+void store_get_person(const RecordStore *store, size_t row, struct Person *out) {
+    const PersonTable *t = &store->people;
+    copy_field(out->name, sizeof(out->name), &store->strings, t->name[row]);
+    out->age = t->age[row];
+    out->height = t->height[row];
+}
+
+void store_get_car(const RecordStore *store, size_t row, Car *out) {
+    const CarTable *t = &store->cars;
+    copy_field(out->brand, sizeof(out->brand), &store->strings, t->brand[row]);
+    copy_field(out->model, sizeof(out->model), &store->strings, t->model[row]);
+    out->year = t->year[row];
+}
+
+void store_get_employee(const RecordStore *store, size_t row, Employee *out) {
+    const EmployeeTable *t = &store->employees;
+    copy_field(out->name, sizeof(out->name), &store->strings, t->name[row]);
+    out->age = t->age[row];
+    copy_field(out->address.street, sizeof(out->address.street), &store->strings, t->street[row]);
+    copy_field(out->address.city, sizeof(out->address.city), &store->strings, t->city[row]);
+    out->address.zipCode = t->zip_code[row];
+}
+
+// ===== COLUMN SCANS =====
+// lo <= x <= hi as ONE unsigned compare: x - lo wraps to a huge number when x < lo
+
+size_t column_count_range(const int *column, size_t count, int lo, int hi) {
+    if (lo > hi) return 0;
+    unsigned width = (unsigned)hi - (unsigned)lo;
+    size_t found = 0;
+    for (size_t i = 0; i < count; i++) {
+        found += (unsigned)column[i] - (unsigned)lo <= width;  // Vectorizes: no branch
+    }
+    return found;
+}
+
+size_t column_filter_range(const int *column, size_t count, int lo, int hi, uint32_t *rows) {
+    if (lo > hi) return 0;
+    unsigned width = (unsigned)hi - (unsigned)lo;
+    size_t found = 0;
+    for (size_t i = 0; i < count; i++) {
+        // Always write, only advance on a match: no branch to mispredict
+        rows[found] = (uint32_t)i;
+        found += (unsigned)column[i] - (unsigned)lo <= width;
+    }
+    return found;
+}
+
+size_t column_filter_ref(const StrRef *column, size_t count, StrRef value, uint32_t *rows) {
+    size_t found = 0;
+    for (size_t i = 0; i < count; i++) {
+        rows[found] = (uint32_t)i;
+        found += column[i] == value;
+    }
+    return found;
+}
+
+// ===== FILTERS =====
+
+size_t people_filter_age(const RecordStore *store, int min_age, int max_age, uint32_t *rows) {
+    return column_filter_range(store->people.age, store->people.count, min_age, max_age, rows);
+}
+
+size_t cars_filter_year(const RecordStore *store, int min_year, int max_year, uint32_t *rows) {
+    return column_filter_range(store->cars.year, store->cars.count, min_year, max_year, rows);
+}
+
+size_t employees_filter_age(const RecordStore *store, int min_age, int max_age, uint32_t *rows) {
+    return column_filter_range(store->employees.age, store->employees.count, min_age, max_age, rows);
+}
+
+size_t employees_filter_city(const RecordStore *store, const char *city, uint32_t *rows) {
+    // A city that was never interned can't match any row
+    StrRef ref = string_pool_find(&store->strings, city);
+    if (ref == STR_NONE) return 0;
+    return column_filter_ref(store->employees.city, store->employees.count, ref, rows);
+}
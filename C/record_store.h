@@ -0,0 +1,118 @@
+#ifndef RECORD_STORE_H
+#define RECORD_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "records.h"
+#include "string_pool.h"
+
+// COLUMNAR RECORD STORE (STRUCT OF ARRAYS)
+// ========================================
+// c07_structs.c keeps records as an ARRAY OF STRUCTS (AoS):
+//
+//   people: [name(50) age height][name(50) age height][name(50) age height]...
+//
+// Filtering by age reads one 4-byte int per 60-byte record, but the CPU
+// loads whole 64-byte cache lines -> ~94% of the memory traffic is wasted.
+//
+// A STRUCT OF ARRAYS (SoA) gives every field its own array ("column"):
+//
+//   age:    [age][age][age][age]...      <- a filter on age touches ONLY this
+//   height: [height][height][height]...
+//   name:   [ref][ref][ref]...           <- 4-byte StrRef into a StringPool
+//
+// - Column scans are sequential and dense: 16 ages per cache line, and
+//   the compiler can vectorize them
+// - Strings are interned (string_pool.h): repeated cities/brands are stored
+//   once, and "city == X" becomes an integer compare
+// - Filters write matching ROW NUMBERS; use them to read any other column
+//
+//   RecordStore *store = record_store_create();
+//   struct Person p = {"Alice", 25, 5.5f};
+//   store_add_person(store, &p);
+//   uint32_t *rows = malloc(store->people.count * sizeof(uint32_t));
+//   size_t n = people_filter_age(store, 20, 29, rows);
+//   for (size_t i = 0; i < n; i++) printf("%s\n", person_name(store, rows[i]));
+//   record_store_free(store);
+//
+// Build: gcc -O2 -o program your_file.c record_store.c string_pool.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    size_t count;
+    size_t capacity;
+    StrRef *name;
+    int *age;
+    float *height;
+} PersonTable;
+
+typedef struct {
+    size_t count;
+    size_t capacity;
+    StrRef *brand;
+    StrRef *model;
+    int *year;
+} CarTable;
+
+typedef struct {
+    size_t count;
+    size_t capacity;
+    StrRef *name;
+    int *age;
+    StrRef *street;     // Address, flattened into columns too
+    StrRef *city;
+    int *zip_code;
+} EmployeeTable;
+
+typedef struct {
+    StringPool strings;     // Shared by every table
+    PersonTable people;
+    CarTable cars;
+    EmployeeTable employees;
+} RecordStore;
+
+RecordStore* record_store_create(void);     // NULL if out of memory
+void record_store_free(RecordStore *store);
+
+// ===== ADD / GET =====
+// Add copies the record in (strings are interned). 0 = success, -1 = out of memory
+// Get rebuilds the c07-style struct for one row
+
+int store_add_person(RecordStore *store, const struct Person *person);
+int store_add_car(RecordStore *store, const Car *car);
+int store_add_employee(RecordStore *store, const Employee *employee);
+
+void store_get_person(const RecordStore *store, size_t row, struct Person *out);
+void store_get_car(const RecordStore *store, size_t row, Car *out);
+void store_get_employee(const RecordStore *store, size_t row, Employee *out);
+
+static inline const char* person_name(const RecordStore *store, size_t row) {
+    return string_pool_get(&store->strings, store->people.name[row]);
+}
+
+// ===== COLUMN SCANS =====
+// Work on any int column. Branch-free, so they run at the same speed
+// whatever fraction of rows matches
+// rows must have room for `count` entries; returns how many were written
+
+size_t column_count_range(const int *column, size_t count, int lo, int hi);     // lo <= x <= hi
+size_t column_filter_range(const int *column, size_t count, int lo, int hi, uint32_t *rows);
+size_t column_filter_ref(const StrRef *column, size_t count, StrRef value, uint32_t *rows);
+
+// ===== FILTERS =====
+// Matching row numbers (ascending) written to rows; returns how many
+
+size_t people_filter_age(const RecordStore *store, int min_age, int max_age, uint32_t *rows);
+size_t cars_filter_year(const RecordStore *store, int min_year, int max_year, uint32_t *rows);
+size_t employees_filter_age(const RecordStore *store, int min_age, int max_age, uint32_t *rows);
+size_t employees_filter_city(const RecordStore *store, const char *city, uint32_t *rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
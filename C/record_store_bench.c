@@ -0,0 +1,132 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "record_store.h"
+
+// RECORD STORE BENCHMARK
+// ======================
+// Same records stored two ways:
+// 1. AoS: struct Person / Employee arrays, exactly as in c07_structs.c
+// 2. SoA: RecordStore columns + string pool
+//
+// - Filter people by age (30..39): the AoS loop drags 60-byte records
+//   through the cache to read 4 bytes each; the SoA loop reads only ages
+// - Filter employees by city: strcmp per record vs one integer compare
+//
+// Build: gcc -O2 -o program record_store_bench.c record_store.c string_pool.c && ./program [people]
+
+#define REPS 10
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned seed = 7;
+static unsigned next_random(void) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 16;
+}
+
+static const char *first_names[] = { "Alice", "Bob", "Carol", "Dave", "Erin", "Frank", "Grace", "Heidi" };
+static const char *cities[] = { "Springfield", "Shelbyville", "Ogdenville", "North Haverbrook",
+                                "Capital City", "Brockway", "Cypress Creek", "Waverly Hills" };
+
+static void report(const char *name, double seconds, size_t records, size_t matches) {
+    printf("  %-28s %8.2f ms  %8.1f M records/s  (%zu matches)\n",
+           name, seconds * 1e3, records / seconds / 1e6, matches);
+}
+
+static void bench_people(size_t count) {
+    struct Person *people = malloc(count * sizeof(struct Person));
+    RecordStore *store = record_store_create();
+    for (size_t i = 0; i < count; i++) {
+        snprintf(people[i].name, sizeof(people[i].name), "%s %zu", first_names[i % 8], i % 5000);
+        people[i].age = (int)(next_random() % 100);
+        people[i].height = 4.5f + (float)(next_random() % 300) / 100.0f;
+        store_add_person(store, &people[i]);
+    }
+    uint32_t *rows = malloc(count * sizeof(uint32_t));
+
+    printf("people: %zu records\n", count);
+    printf("  memory: AoS %zu MB, SoA %zu MB (columns) + %zu KB (pooled names)\n",
+           count * sizeof(struct Person) >> 20,
+           count * (sizeof(StrRef) + sizeof(int) + sizeof(float)) >> 20,
+           store->strings.used >> 10);
+
+    // AoS, written the obvious way
+    size_t matches = 0;
+    double start = now_sec();
+    for (int r = 0; r < REPS; r++) {
+        matches = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (people[i].age >= 30 && people[i].age <= 39) rows[matches++] = (uint32_t)i;
+        }
+    }
+    report("AoS filter age 30-39", (now_sec() - start) / REPS, count, matches);
+
+    start = now_sec();
+    for (int r = 0; r < REPS; r++) matches = people_filter_age(store, 30, 39, rows);
+    report("SoA people_filter_age", (now_sec() - start) / REPS, count, matches);
+
+    start = now_sec();
+    for (int r = 0; r < REPS; r++) {
+        matches = 0;
+        for (size_t i = 0; i < count; i++) matches += people[i].age >= 30 && people[i].age <= 39;
+    }
+    report("AoS count age 30-39", (now_sec() - start) / REPS, count, matches);
+
+    start = now_sec();
+    for (int r = 0; r < REPS; r++) matches = column_count_range(store->people.age, count, 30, 39);
+    report("SoA column_count_range", (now_sec() - start) / REPS, count, matches);
+
+    free(rows);
+    free(people);
+    record_store_free(store);
+}
+
+static void bench_employees(size_t count) {
+    Employee *employees = malloc(count * sizeof(Employee));
+    RecordStore *store = record_store_create();
+    for (size_t i = 0; i < count; i++) {
+        snprintf(employees[i].name, sizeof(employees[i].name), "%s %zu", first_names[i % 8], i);
+        employees[i].age = 20 + (int)(next_random() % 45);
+        snprintf(employees[i].address.street, sizeof(employees[i].address.street), "%u Main St", next_random() % 999);
+        strcpy(employees[i].address.city, cities[next_random() % 8]);
+        employees[i].address.zipCode = 10000 + (int)(next_random() % 90000);
+        store_add_employee(store, &employees[i]);
+    }
+    uint32_t *rows = malloc(count * sizeof(uint32_t));
+
+    printf("\nemployees: %zu records\n", count);
+    size_t matches = 0;
+    double start = now_sec();
+    for (int r = 0; r < REPS; r++) {
+        matches = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (strcmp(employees[i].address.city, "Ogdenville") == 0) rows[matches++] = (uint32_t)i;
+        }
+    }
+    report("AoS strcmp city", (now_sec() - start) / REPS, count, matches);
+
+    start = now_sec();
+    for (int r = 0; r < REPS; r++) matches = employees_filter_city(store, "Ogdenville", rows);
+    report("SoA employees_filter_city", (now_sec() - start) / REPS, count, matches);
+
+    free(rows);
+    free(employees);
+    record_store_free(store);
+}
+
+int main(int argc, char *argv[]) {
+    size_t people = argc > 1 ? strtoull(argv[1], NULL, 10) : 2000000;
+    if (people == 0) people = 1;
+
+    bench_people(people);
+    bench_employees(people / 4 + 1);
+    return 0;
+}
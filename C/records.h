@@ -0,0 +1,36 @@
+#ifndef RECORDS_H
+#define RECORDS_H
+
+// RECORD TYPES
+// ============
+// The structs from c07_structs.c, shared by the record store and its benchmark
+// (c07_structs.c keeps its own copy so it still compiles on its own)
+// Fixed char arrays make every record the same size, but most of each record
+// is unused name bytes:
+//   sizeof(struct Person) = 60, sizeof(Car) = 104, sizeof(Employee) = 212
+
+struct Person {
+    char name[50];
+    int age;
+    float height;
+};
+
+typedef struct {
+    char brand[50];
+    char model[50];
+    int year;
+} Car;
+
+typedef struct {
+    char street[100];
+    char city[50];
+    int zipCode;
+} Address;
+
+typedef struct {
+    char name[50];
+    int age;
+    Address address;
+} Employee;
+
+#endif
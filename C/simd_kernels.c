@@ -0,0 +1,391 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "simd_kernels.h"
+
+// SIMD KERNELS - IMPLEMENTATION
+// =============================
+// Each kernel exists in up to 4 versions (scalar, SSE2, AVX2, AVX-512)
+// __attribute__((target("avx2"))) lets ONE file contain AVX2 code without
+// compiling the whole program with -mavx2 - it only runs if the CPU has it
+//
+// Pattern used by every SIMD loop:
+//   1. Process full vectors (4/8/16 ints per step) with unaligned loads
+//   2. Finish the leftover tail (< one vector) with the scalar code
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// ===== SCALAR (reference versions, run on every CPU) =====
+
+static int64_t sum_scalar(const int32_t *a, size_t n) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < n; i++) sum += a[i];
+    return sum;
+}
+
+// Shared by all versions to finish the tail; min/max must already hold a value
+static void minmax_scalar_into(const int32_t *a, size_t n, int32_t *min, int32_t *max) {
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] < *min) *min = a[i];
+        if (a[i] > *max) *max = a[i];
+    }
+}
+
+static void minmax_scalar(const int32_t *a, size_t n, int32_t *min, int32_t *max) {
+    *min = *max = a[0];
+    minmax_scalar_into(a + 1, n - 1, min, max);
+}
+
+static size_t count_eq_scalar(const int32_t *a, size_t n, int32_t value) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) count += a[i] == value;
+    return count;
+}
+
+// Unsigned running total: wraps instead of signed-overflow undefined behavior
+static void prefix_sum_scalar_from(const int32_t *in, int32_t *out, size_t n, uint32_t total) {
+    for (size_t i = 0; i < n; i++) {
+        total += (uint32_t)in[i];
+        out[i] = (int32_t)total;
+    }
+}
+
+static void prefix_sum_scalar(const int32_t *in, int32_t *out, size_t n) {
+    prefix_sum_scalar_from(in, out, n, 0);
+}
+
+static size_t find_first_scalar(const int32_t *a, size_t n, int32_t value) {
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] == value) return i;
+    }
+    return n;
+}
+
+static const SimdKernels scalar_kernels = {
+    sum_scalar, minmax_scalar, count_eq_scalar, prefix_sum_scalar, find_first_scalar
+};
+
+#ifdef SIMD_X86
+
+// ===== SSE2 (4 ints per step) =====
+
+#define SSE2 __attribute__((target("sse2")))
+
+SSE2 static int64_t sum_sse2(const int32_t *a, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        // Widen 32 -> 64 bit: pair each int with its sign (all 1s if negative)
+        __m128i sign = _mm_cmpgt_epi32(zero, v);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    return lanes[0] + lanes[1] + sum_scalar(a + i, n - i);
+}
+
+// SSE2 has no 32-bit min/max instruction: select with a compare mask
+SSE2 static inline __m128i select_sse2(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+SSE2 static void minmax_sse2(const int32_t *a, size_t n, int32_t *min, int32_t *max) {
+    if (n < 4) {
+        minmax_scalar(a, n, min, max);
+        return;
+    }
+    __m128i vmin = _mm_loadu_si128((const __m128i*)a);
+    __m128i vmax = vmin;
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        vmin = select_sse2(_mm_cmplt_epi32(v, vmin), v, vmin);
+        vmax = select_sse2(_mm_cmpgt_epi32(v, vmax), v, vmax);
+    }
+    int32_t lo[4], hi[4];
+    _mm_storeu_si128((__m128i*)lo, vmin);
+    _mm_storeu_si128((__m128i*)hi, vmax);
+    *min = lo[0];
+    *max = hi[0];
+    minmax_scalar_into(lo + 1, 3, min, max);
+    minmax_scalar_into(hi + 1, 3, min, max);
+    minmax_scalar_into(a + i, n - i, min, max);
+}
+
+// A match compares as -1 (all bits set), so subtracting the compare result counts it
+// Per-lane counters are flushed every block so they can never overflow
+SSE2 static size_t count_eq_sse2(const int32_t *a, size_t n, int32_t value) {
+    const size_t block = (size_t)1 << 20;  // Vectors per flush
+    __m128i needle = _mm_set1_epi32(value);
+    size_t count = 0;
+    size_t i = 0;
+    while (i + 4 <= n) {
+        __m128i acc = _mm_setzero_si128();
+        size_t end = n - i > block * 4 ? i + block * 4 : n;
+        for (; i + 4 <= end; i += 4) {
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), needle));
+        }
+        uint32_t lanes[4];
+        _mm_storeu_si128((__m128i*)lanes, acc);
+        count += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    return count + count_eq_scalar(a + i, n - i, value);
+}
+
+// In-register scan: add the vector to itself shifted by 1 lane, then by 2 lanes
+//   [a b c d] + [0 a b c] = [a ab bc cd];  + [0 0 a ab] = [a ab abc abcd]
+SSE2 static void prefix_sum_sse2(const int32_t *in, int32_t *out, size_t n) {
+    __m128i carry = _mm_setzero_si128();  // Running total, broadcast to all lanes
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(in + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+        carry = _mm_shuffle_epi32(x, 0xFF);  // Broadcast last lane
+    }
+    prefix_sum_scalar_from(in + i, out + i, n - i, (uint32_t)_mm_cvtsi128_si32(carry));
+}
+
+SSE2 static size_t find_first_sse2(const int32_t *a, size_t n, int32_t value) {
+    __m128i needle = _mm_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask != 0) return i + __builtin_ctz(mask);  // Lowest set bit = first match
+    }
+    return i + find_first_scalar(a + i, n - i, value);
+}
+
+static const SimdKernels sse2_kernels = {
+    sum_sse2, minmax_sse2, count_eq_sse2, prefix_sum_sse2, find_first_sse2
+};
+
+// ===== AVX2 (8 ints per step) =====
+
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 static int64_t sum_avx2(const int32_t *a, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i))));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i + 4))));
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(a + i, n - i);
+}
+
+AVX2 static void minmax_avx2(const int32_t *a, size_t n, int32_t *min, int32_t *max) {
+    if (n < 8) {
+        minmax_scalar(a, n, min, max);
+        return;
+    }
+    __m256i vmin = _mm256_loadu_si256((const __m256i*)a);
+    __m256i vmax = vmin;
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+        vmin = _mm256_min_epi32(vmin, v);
+        vmax = _mm256_max_epi32(vmax, v);
+    }
+    int32_t lo[8], hi[8];
+    _mm256_storeu_si256((__m256i*)lo, vmin);
+    _mm256_storeu_si256((__m256i*)hi, vmax);
+    *min = lo[0];
+    *max = hi[0];
+    minmax_scalar_into(lo + 1, 7, min, max);
+    minmax_scalar_into(hi + 1, 7, min, max);
+    minmax_scalar_into(a + i, n - i, min, max);
+}
+
+AVX2 static size_t count_eq_avx2(const int32_t *a, size_t n, int32_t value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), needle);
+        count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+    }
+    return count + count_eq_scalar(a + i, n - i, value);
+}
+
+// Scan each 128-bit half like SSE2, then add the low half's total to the high half
+AVX2 static void prefix_sum_avx2(const int32_t *in, int32_t *out, size_t n) {
+    __m256i carry = _mm256_setzero_si256();
+    __m256i last = _mm256_set1_epi32(7);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(in + i));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));   // Shifts within each half
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        __m256i low_total = _mm256_shuffle_epi32(x, 0xFF);  // Last lane of each half
+        x = _mm256_add_epi32(x, _mm256_permute2x128_si256(low_total, low_total, 0x08));  // [0, low]
+        x = _mm256_add_epi32(x, carry);
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+        carry = _mm256_permutevar8x32_epi32(x, last);
+    }
+    prefix_sum_scalar_from(in + i, out + i, n - i, (uint32_t)_mm256_cvtsi256_si32(carry));
+}
+
+AVX2 static size_t find_first_avx2(const int32_t *a, size_t n, int32_t value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return i + find_first_scalar(a + i, n - i, value);
+}
+
+static const SimdKernels avx2_kernels = {
+    sum_avx2, minmax_avx2, count_eq_avx2, prefix_sum_avx2, find_first_avx2
+};
+
+// ===== AVX-512 (16 ints per step) =====
+// Compares produce a 16-bit mask register directly - no movemask needed
+
+#define AVX512 __attribute__((target("avx512f")))
+
+AVX512 static int64_t sum_avx512(const int32_t *a, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc = _mm512_add_epi64(acc, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(a + i))));
+        acc = _mm512_add_epi64(acc, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(a + i + 8))));
+    }
+    return _mm512_reduce_add_epi64(acc) + sum_scalar(a + i, n - i);
+}
+
+AVX512 static void minmax_avx512(const int32_t *a, size_t n, int32_t *min, int32_t *max) {
+    if (n < 16) {
+        minmax_scalar(a, n, min, max);
+        return;
+    }
+    __m512i vmin = _mm512_loadu_si512(a);
+    __m512i vmax = vmin;
+    size_t i = 16;
+    for (; i + 16 <= n; i += 16) {
+        __m512i v = _mm512_loadu_si512(a + i);
+        vmin = _mm512_min_epi32(vmin, v);
+        vmax = _mm512_max_epi32(vmax, v);
+    }
+    *min = _mm512_reduce_min_epi32(vmin);
+    *max = _mm512_reduce_max_epi32(vmax);
+    minmax_scalar_into(a + i, n - i, min, max);
+}
+
+AVX512 static size_t count_eq_avx512(const int32_t *a, size_t n, int32_t value) {
+    __m512i needle = _mm512_set1_epi32(value);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        count += __builtin_popcount(_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(a + i), needle));
+    }
+    return count + count_eq_scalar(a + i, n - i, value);
+}
+
+// Log-step scan across the full register: shift in zeros by 1, 2, 4, 8 lanes
+// alignr(x, 0, 16 - k) = x moved up k lanes with zeros underneath
+AVX512 static void prefix_sum_avx512(const int32_t *in, int32_t *out, size_t n) {
+    __m512i zero = _mm512_setzero_si512();
+    __m512i carry = zero;
+    __m512i last = _mm512_set1_epi32(15);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i x = _mm512_loadu_si512(in + i);
+        x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 15));
+        x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 14));
+        x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 12));
+        x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 8));
+        x = _mm512_add_epi32(x, carry);
+        _mm512_storeu_si512(out + i, x);
+        carry = _mm512_permutexvar_epi32(last, x);
+    }
+    prefix_sum_scalar_from(in + i, out + i, n - i, (uint32_t)_mm512_cvtsi512_si32(carry));
+}
+
+AVX512 static size_t find_first_avx512(const int32_t *a, size_t n, int32_t value) {
+    __m512i needle = _mm512_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(a + i), needle);
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return i + find_first_scalar(a + i, n - i, value);
+}
+
+static const SimdKernels avx512_kernels = {
+    sum_avx512, minmax_avx512, count_eq_avx512, prefix_sum_avx512, find_first_avx512
+};
+
+#endif  // SIMD_X86
+
+// ===== RUNTIME DISPATCH =====
+
+SimdLevel simd_detect(void) {
+#ifdef SIMD_X86
+    __builtin_cpu_init();  // Needed when called before main (from a constructor)
+    if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+#endif
+    return SIMD_SCALAR;
+}
+
+const char* simd_level_name(SimdLevel level) {
+    static const char *names[SIMD_LEVEL_COUNT] = { "scalar", "sse2", "avx2", "avx512" };
+    return level < SIMD_LEVEL_COUNT ? names[level] : "unknown";
+}
+
+const SimdKernels* simd_kernels_for(SimdLevel level) {
+    if (level >= SIMD_LEVEL_COUNT || level > simd_detect()) return NULL;
+    switch (level) {
+#ifdef SIMD_X86
+        case SIMD_SSE2: return &sse2_kernels;
+        case SIMD_AVX2: return &avx2_kernels;
+        case SIMD_AVX512: return &avx512_kernels;
+#endif
+        case SIMD_SCALAR: return &scalar_kernels;
+        default: return NULL;
+    }
+}
+
+// Chosen once at program start, before main runs
+static const SimdKernels *active = &scalar_kernels;
+
+__attribute__((constructor)) static void simd_init(void) {
+    active = simd_kernels_for(simd_detect());
+}
+
+int64_t simd_sum_i32(const int32_t *a, size_t n) {
+    return active->sum(a, n);
+}
+
+int simd_minmax_i32(const int32_t *a, size_t n, int32_t *min, int32_t *max) {
+    if (n == 0) return -1;
+    active->minmax(a, n, min, max);
+    return 0;
+}
+
+size_t simd_count_eq_i32(const int32_t *a, size_t n, int32_t value) {
+    return active->count_eq(a, n, value);
+}
+
+void simd_prefix_sum_i32(const int32_t *in, int32_t *out, size_t n) {
+    active->prefix_sum(in, out, n);
+}
+
+size_t simd_find_first_i32(const int32_t *a, size_t n, int32_t value) {
+    return active->find_first(a, n, value);
+}
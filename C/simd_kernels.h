@@ -0,0 +1,75 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// SIMD KERNELS FOR INT ARRAYS
+// ===========================
+// Vectorized versions of the simple loops from c10_loops.c / array_print
+// SIMD = Single Instruction, Multiple Data: one instruction works on 4/8/16 ints
+//   SSE2    - 128-bit registers, 4 ints at a time (every x86-64 CPU has it)
+//   AVX2    - 256-bit registers, 8 ints at a time
+//   AVX-512 - 512-bit registers, 16 ints at a time
+//
+// The best version is picked at RUNTIME by asking the CPU what it supports,
+// so one binary runs everywhere. Non-x86 CPUs use the scalar (plain loop) code.
+// Every kernel returns exactly the same result as the scalar loop.
+//
+// Works directly on DynamicArray contents:
+//   int64_t total = simd_sum_i32((const int32_t*)arr->data, arr->size);
+//
+// Build: gcc -O2 -o program your_file.c simd_kernels.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_AVX2,
+    SIMD_AVX512,
+    SIMD_LEVEL_COUNT
+} SimdLevel;
+
+// Raw kernels (minmax requires n >= 1 - the dispatching API checks for you)
+typedef struct {
+    int64_t (*sum)(const int32_t *a, size_t n);
+    void (*minmax)(const int32_t *a, size_t n, int32_t *min, int32_t *max);
+    size_t (*count_eq)(const int32_t *a, size_t n, int32_t value);
+    void (*prefix_sum)(const int32_t *in, int32_t *out, size_t n);
+    size_t (*find_first)(const int32_t *a, size_t n, int32_t value);
+} SimdKernels;
+
+// Best level this CPU supports, and its name ("scalar", "sse2", ...)
+SimdLevel simd_detect(void);
+const char* simd_level_name(SimdLevel level);
+
+// Kernel table for one level, or NULL if the CPU/compiler can't run it
+// (Used by tests/benchmarks to compare levels side by side)
+const SimdKernels* simd_kernels_for(SimdLevel level);
+
+// ===== DISPATCHING API (uses the best level) =====
+
+// Sum widened to 64 bits - never overflows for realistic sizes
+int64_t simd_sum_i32(const int32_t *a, size_t n);
+
+// Smallest and largest element; returns -1 (outputs untouched) if n == 0
+int simd_minmax_i32(const int32_t *a, size_t n, int32_t *min, int32_t *max);
+
+// How many elements equal value
+size_t simd_count_eq_i32(const int32_t *a, size_t n, int32_t value);
+
+// Inclusive prefix sum: out[i] = in[0] + ... + in[i]
+// Wraps around on overflow (like unsigned math); in == out is allowed
+void simd_prefix_sum_i32(const int32_t *in, int32_t *out, size_t n);
+
+// Index of the first element equal to value, or n if not found
+size_t simd_find_first_i32(const int32_t *a, size_t n, int32_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "simd_kernels.h"
+
+// SIMD KERNELS BENCHMARK
+// ======================
+// Throughput (GB/s of input read) of every kernel at every supported level
+// Default 16K ints (64 KiB, fits in L2) and 16M ints (64 MiB, memory-bound)
+//
+// Build: gcc -O2 -o program simd_kernels_bench.c simd_kernels.c && ./program [count]
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static volatile long long sink;  // Keeps results "used" so the compiler can't drop the calls
+
+static void print_rate(size_t bytes, size_t reps, double seconds) {
+    printf(" %8.2f", (double)bytes * reps / seconds / 1e9);
+}
+
+static void bench_size(size_t n) {
+    int32_t *a = malloc(n * sizeof(int32_t));
+    int32_t *out = malloc(n * sizeof(int32_t));
+    for (size_t i = 0; i < n; i++) a[i] = (int32_t)(i * 2654435761u) % 1000;  // -999..999
+
+    size_t bytes = n * sizeof(int32_t);
+    size_t reps = (size_t)(2e9 / bytes) + 1;  // ~2 GB of traffic per measurement
+
+    printf("\n%zu ints (%zu KiB), GB/s:\n", n, bytes / 1024);
+    printf("%-8s %8s %8s %8s %8s %8s\n", "level", "sum", "minmax", "count", "prefix", "find");
+
+    for (int level = 0; level < SIMD_LEVEL_COUNT; level++) {
+        const SimdKernels *k = simd_kernels_for((SimdLevel)level);
+        if (k == NULL) continue;
+        printf("%-8s", simd_level_name((SimdLevel)level));
+
+        double t = now_sec();
+        for (size_t r = 0; r < reps; r++) sink += k->sum(a, n);
+        print_rate(bytes, reps, now_sec() - t);
+
+        t = now_sec();
+        for (size_t r = 0; r < reps; r++) {
+            int32_t min, max;
+            k->minmax(a, n, &min, &max);
+            sink += min + max;
+        }
+        print_rate(bytes, reps, now_sec() - t);
+
+        t = now_sec();
+        for (size_t r = 0; r < reps; r++) sink += k->count_eq(a, n, 7);
+        print_rate(bytes, reps, now_sec() - t);
+
+        t = now_sec();
+        for (size_t r = 0; r < reps; r++) {
+            k->prefix_sum(a, out, n);
+            sink += out[n - 1];
+        }
+        print_rate(bytes, reps, now_sec() - t);
+
+        t = now_sec();
+        for (size_t r = 0; r < reps; r++) sink += k->find_first(a, n, 1000);  // Never found: full scan
+        print_rate(bytes, reps, now_sec() - t);
+
+        printf("\n");
+    }
+
+    free(a);
+    free(out);
+}
+
+int main(int argc, char *argv[]) {
+    printf("Best level on this CPU: %s\n", simd_level_name(simd_detect()));
+
+    if (argc > 1) {
+        size_t n = strtoull(argv[1], NULL, 10);
+        bench_size(n > 0 ? n : 1);
+    } else {
+        bench_size(16 * 1024);
+        bench_size(16 * 1024 * 1024);
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd_kernels.h"
+
+// Checks every SIMD level against the scalar kernels - results must be bit-exact
+// Sizes 0..200 cover every tail length; offsets 0..3 cover unaligned starts
+//
+// Build: gcc -O2 -o program simd_kernels_test.c simd_kernels.c && ./program
+
+#define MAX_N 4096
+
+static int failures = 0;
+
+static void check(int ok, const char *level, const char *kernel, size_t n, size_t offset) {
+    if (!ok) {
+        printf("FAIL %s %s n=%zu offset=%zu\n", level, kernel, n, offset);
+        failures++;
+    }
+}
+
+static uint32_t rng_state = 12345;
+static int32_t next_rand(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (int32_t)rng_state;
+}
+
+// Mix of full-range values (to hit overflow/wraparound) and small values (to get matches)
+static void fill(int32_t *a, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int32_t r = next_rand();
+        a[i] = (i % 3 == 0) ? r : r % 8;
+    }
+    if (n > 2) {
+        a[n / 2] = INT32_MIN;
+        a[n - 1] = INT32_MAX;
+    }
+}
+
+static void compare(const SimdKernels *ref, const SimdKernels *k, const char *level,
+                    const int32_t *a, size_t n, size_t offset) {
+    static int32_t out_ref[MAX_N], out_k[MAX_N];
+
+    check(ref->sum(a, n) == k->sum(a, n), level, "sum", n, offset);
+
+    if (n > 0) {
+        int32_t min_ref, max_ref, min_k, max_k;
+        ref->minmax(a, n, &min_ref, &max_ref);
+        k->minmax(a, n, &min_k, &max_k);
+        check(min_ref == min_k && max_ref == max_k, level, "minmax", n, offset);
+    }
+
+    for (int32_t v = -1; v < 8; v++) {
+        check(ref->count_eq(a, n, v) == k->count_eq(a, n, v), level, "count_eq", n, offset);
+        check(ref->find_first(a, n, v) == k->find_first(a, n, v), level, "find_first", n, offset);
+    }
+    check(ref->find_first(a, n, 123456789) == k->find_first(a, n, 123456789), level, "find_first (absent)", n, offset);
+
+    ref->prefix_sum(a, out_ref, n);
+    k->prefix_sum(a, out_k, n);
+    check(memcmp(out_ref, out_k, n * sizeof(int32_t)) == 0, level, "prefix_sum", n, offset);
+
+    // In-place (in == out)
+    memcpy(out_k, a, n * sizeof(int32_t));
+    k->prefix_sum(out_k, out_k, n);
+    check(memcmp(out_ref, out_k, n * sizeof(int32_t)) == 0, level, "prefix_sum in-place", n, offset);
+}
+
+int main() {
+    static int32_t buffer[MAX_N + 4];
+    const SimdKernels *ref = simd_kernels_for(SIMD_SCALAR);
+
+    printf("Detected: %s\n", simd_level_name(simd_detect()));
+
+    for (int level = SIMD_SSE2; level < SIMD_LEVEL_COUNT; level++) {
+        const SimdKernels *k = simd_kernels_for((SimdLevel)level);
+        const char *name = simd_level_name((SimdLevel)level);
+        if (k == NULL) {
+            printf("skip %s (not supported)\n", name);
+            continue;
+        }
+
+        int before = failures;
+        for (size_t offset = 0; offset < 4; offset++) {
+            for (size_t n = 0; n <= 200; n++) {
+                fill(buffer + offset, n);
+                compare(ref, k, name, buffer + offset, n, offset);
+            }
+            fill(buffer + offset, MAX_N);
+            compare(ref, k, name, buffer + offset, MAX_N, offset);
+        }
+        printf("%-7s %s\n", name, failures == before ? "ok" : "FAILED");
+    }
+
+    // Dispatching API
+    int32_t min, max;
+    if (simd_minmax_i32(buffer, 0, &min, &max) != -1) {
+        printf("FAIL simd_minmax_i32 on empty input\n");
+        failures++;
+    }
+
+    printf(failures == 0 ? "All tests passed\n" : "%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "small_array.h"
+
+// SMALL-BUFFER-OPTIMIZED INT ARRAY - IMPLEMENTATION
+// =================================================
+
+void small_array_init(SmallArray *arr) {
+    arr->size = 0;
+    arr->capacity = SMALL_ARRAY_INLINE;
+}
+
+void small_array_destroy(SmallArray *arr) {
+    if (arr->capacity > SMALL_ARRAY_INLINE) free(arr->storage.heap);
+    small_array_init(arr);
+}
+
+// Move to a heap block of new_capacity (> SMALL_ARRAY_INLINE)
+static int grow_to(SmallArray *arr, int new_capacity) {
+    int *data;
+    if (arr->capacity > SMALL_ARRAY_INLINE) {
+        data = realloc(arr->storage.heap, new_capacity * sizeof(int));
+        if (data == NULL) return -1;
+    } else {
+        // Spill: copy the inline elements out before the union is reused for the pointer
+        data = malloc(new_capacity * sizeof(int));
+        if (data == NULL) return -1;
+        memcpy(data, arr->storage.inline_buf, arr->size * sizeof(int));
+    }
+    arr->storage.heap = data;
+    arr->capacity = new_capacity;
+    return 0;
+}
+
+SmallArray* small_array_create(int initial_capacity) {
+    SmallArray *arr = malloc(sizeof(SmallArray));
+    if (arr == NULL) return NULL;
+
+    small_array_init(arr);
+    if (initial_capacity > SMALL_ARRAY_INLINE && grow_to(arr, initial_capacity) != 0) {
+        free(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+void small_array_free(SmallArray *arr) {
+    if (arr == NULL) return;
+    small_array_destroy(arr);
+    free(arr);
+}
+
+// O(1) amortized push - doubles capacity when full, like array_push
+void small_array_push(SmallArray *arr, int value) {
+    if (arr->size >= arr->capacity && grow_to(arr, arr->capacity * 2) != 0) {
+        printf("Out of memory!\n");
+        return;
+    }
+    small_array_data(arr)[arr->size++] = value;
+}
+
+int small_array_pop(SmallArray *arr) {
+    if (arr->size <= 0) {
+        printf("Array is empty!\n");
+        return -1; // Error value
+    }
+    return small_array_data(arr)[--arr->size];
+}
+
+void small_array_print(SmallArray *arr) {
+    int *data = small_array_data(arr);
+    printf("[");
+    for (int i = 0; i < arr->size; i++) {
+        printf("%d", data[i]);
+        if (i < arr->size - 1) printf(", ");
+    }
+    printf("] (size: %d, capacity: %d, %s)\n", arr->size, arr->capacity,
+           arr->capacity > SMALL_ARRAY_INLINE ? "heap" : "inline");
+}
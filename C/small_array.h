@@ -0,0 +1,57 @@
+#ifndef SMALL_ARRAY_H
+#define SMALL_ARRAY_H
+
+// SMALL-BUFFER-OPTIMIZED INT ARRAY
+// ================================
+// Same API as the DynamicArray in efficient_dynamic_array.c (create, push,
+// pop, print, free), but the first SMALL_ARRAY_INLINE ints live INSIDE the
+// struct. Only arrays that outgrow that spill to a heap block.
+//
+// efficient_dynamic_array.c: array_create = 2 mallocs (struct + data)
+// SmallArray:                small_array_create = 1 malloc (data is inline)
+//                            small_array_init on a stack variable = 0 mallocs
+//
+//   SmallArray arr;            // Lives on the stack
+//   small_array_init(&arr);
+//   small_array_push(&arr, 10);
+//   small_array_destroy(&arr); // Frees the heap block only if it spilled
+//
+// Build: gcc -O2 -o program your_file.c small_array.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SMALL_ARRAY_INLINE 16
+
+typedef struct {
+    int size;       // Current number of elements
+    int capacity;   // SMALL_ARRAY_INLINE while inline, heap capacity after spilling
+    union {
+        int inline_buf[SMALL_ARRAY_INLINE];  // Used while capacity == SMALL_ARRAY_INLINE
+        int *heap;                           // Used after spilling
+    } storage;
+} SmallArray;
+// No pointer into itself, so a SmallArray can be copied/moved with memcpy
+
+static inline int* small_array_data(SmallArray *arr) {
+    return arr->capacity > SMALL_ARRAY_INLINE ? arr->storage.heap : arr->storage.inline_buf;
+}
+
+// Heap-allocated, like array_create (initial_capacity > SMALL_ARRAY_INLINE spills immediately)
+SmallArray* small_array_create(int initial_capacity);
+void small_array_free(SmallArray *arr);
+
+// For arrays embedded in another struct or on the stack
+void small_array_init(SmallArray *arr);
+void small_array_destroy(SmallArray *arr);
+
+void small_array_push(SmallArray *arr, int value);
+int small_array_pop(SmallArray *arr);   // Prints a message and returns -1 when empty
+void small_array_print(SmallArray *arr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "small_array.h"
+#ifdef ALLOC_TRACK
+#include "alloc_track.h"
+#endif
+
+// SMALL ARRAY BENCHMARK
+// =====================
+// Builds and frees a million short int arrays (1..20 elements, 80% of them <= 16)
+// 1. DynamicArray from efficient_dynamic_array.c (struct + data = 2 mallocs)
+// 2. SmallArray via small_array_create (1 malloc unless it spills)
+// 3. SmallArray on the stack via small_array_init (0 mallocs unless it spills)
+//
+// Timing:            gcc -O2 -o program small_array_bench.c small_array.c && ./program [arrays]
+// Allocation counts: gcc -O2 -DALLOC_TRACK -include alloc_track.h -o program
+//                        small_array_bench.c small_array.c alloc_track.c && ./program [arrays]
+// (Timings in the ALLOC_TRACK build include the tracking overhead)
+
+// ===== BASELINE: copied from efficient_dynamic_array.c =====
+
+typedef struct {
+    int *data;
+    int size;
+    int capacity;
+} DynamicArray;
+
+static DynamicArray* array_create(int initial_capacity) {
+    DynamicArray *arrP = malloc(sizeof(DynamicArray));
+    arrP->data = malloc(initial_capacity * sizeof(int));
+    arrP->size = 0;
+    arrP->capacity = initial_capacity;
+    return arrP;
+}
+
+static void array_push(DynamicArray *arr, int value) {
+    if (arr->size >= arr->capacity) {
+        arr->capacity *= 2;
+        arr->data = realloc(arr->data, arr->capacity * sizeof(int));
+    }
+    arr->data[arr->size++] = value;
+}
+
+static void array_free(DynamicArray *arr) {
+    free(arr->data);
+    free(arr);
+}
+
+// ===== BENCHMARKS =====
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 1..20 elements spread evenly: 80% of arrays fit inline, the rest spill
+static int array_len(size_t i) {
+    return 1 + (int)(((unsigned)i * 2654435761u) % 20);
+}
+
+static void report(const char *name, size_t arrays, double seconds, long long checksum) {
+    printf("%-26s %8.2f ms  %7.2f M arrays/s", name, seconds * 1e3, arrays / seconds / 1e6);
+#ifdef ALLOC_TRACK
+    AllocStats stats;
+    alloc_track_stats(&stats);
+    size_t calls = stats.malloc_calls + stats.calloc_calls + stats.realloc_calls;
+    printf("  %8zu allocs (%.2f per array)", calls, (double)calls / arrays);
+    alloc_track_reset_counters();
+#endif
+    printf("  (checksum %lld)\n", checksum);
+}
+
+static void bench_dynamic_array(size_t arrays) {
+    long long checksum = 0;
+    double start = now_sec();
+    for (size_t i = 0; i < arrays; i++) {
+        DynamicArray *arr = array_create(4);
+        int len = array_len(i);
+        for (int v = 0; v < len; v++) array_push(arr, v);
+        checksum += arr->data[arr->size - 1];
+        array_free(arr);
+    }
+    report("DynamicArray (2 mallocs)", arrays, now_sec() - start, checksum);
+}
+
+static void bench_small_create(size_t arrays) {
+    long long checksum = 0;
+    double start = now_sec();
+    for (size_t i = 0; i < arrays; i++) {
+        SmallArray *arr = small_array_create(4);
+        int len = array_len(i);
+        for (int v = 0; v < len; v++) small_array_push(arr, v);
+        checksum += small_array_data(arr)[arr->size - 1];
+        small_array_free(arr);
+    }
+    report("SmallArray (heap)", arrays, now_sec() - start, checksum);
+}
+
+static void bench_small_stack(size_t arrays) {
+    long long checksum = 0;
+    double start = now_sec();
+    for (size_t i = 0; i < arrays; i++) {
+        SmallArray arr;
+        small_array_init(&arr);
+        int len = array_len(i);
+        for (int v = 0; v < len; v++) small_array_push(&arr, v);
+        checksum += small_array_data(&arr)[arr.size - 1];
+        small_array_destroy(&arr);
+    }
+    report("SmallArray (stack)", arrays, now_sec() - start, checksum);
+}
+
+int main(int argc, char *argv[]) {
+    size_t arrays = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+
+#ifdef ALLOC_TRACK
+    alloc_track_reset_counters();
+#endif
+    printf("%zu arrays of 1..20 ints (inline capacity %d)\n\n", arrays, SMALL_ARRAY_INLINE);
+    bench_dynamic_array(arrays);
+    bench_small_create(arrays);
+    bench_small_stack(arrays);
+    return 0;
+}
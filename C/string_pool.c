@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "string_pool.h"
+
+// STRING POOL - IMPLEMENTATION
+// ============================
+// Open addressing hash table (linear probing) of refs, kept at most half full
+
+#define MIN_DATA  4096
+#define MIN_SLOTS 64
+
+static uint64_t hash_string(const char *str, size_t len) {
+    uint64_t h = 1469598103934665603ULL;  // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)str[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Does the pooled string at ref equal str[0..len)?
+static int pooled_equals(const StringPool *pool, StrRef ref, const char *str, size_t len) {
+    const char *stored = pool->data + ref;
+    return strncmp(stored, str, len) == 0 && stored[len] == '\0';
+}
+
+void string_pool_init(StringPool *pool) {
+    pool->data = NULL;
+    pool->used = 0;
+    pool->cap = 0;
+    pool->slots = NULL;
+    pool->slot_count = 0;
+    pool->count = 0;
+}
+
+void string_pool_destroy(StringPool *pool) {
+    free(pool->data);
+    free(pool->slots);
+    string_pool_init(pool);
+}
+
+static int grow_slots(StringPool *pool) {
+    size_t new_count = pool->slot_count == 0 ? MIN_SLOTS : pool->slot_count * 2;
+    StrRef *slots = malloc(new_count * sizeof(StrRef));
+    if (slots == NULL) return -1;
+    for (size_t i = 0; i < new_count; i++) slots[i] = STR_NONE;
+
+    // Re-insert every ref at its position in the bigger table
+    for (size_t i = 0; i < pool->slot_count; i++) {
+        StrRef ref = pool->slots[i];
+        if (ref == STR_NONE) continue;
+        const char *stored = pool->data + ref;
+        size_t slot = (size_t)hash_string(stored, strlen(stored)) & (new_count - 1);
+        while (slots[slot] != STR_NONE) slot = (slot + 1) & (new_count - 1);
+        slots[slot] = ref;
+    }
+    free(pool->slots);
+    pool->slots = slots;
+    pool->slot_count = new_count;
+    return 0;
+}
+
+StrRef string_pool_intern_n(StringPool *pool, const char *str, size_t len) {
+    if ((pool->count + 1) * 2 > pool->slot_count && grow_slots(pool) != 0) return STR_NONE;
+
+    size_t mask = pool->slot_count - 1;
+    size_t slot = (size_t)hash_string(str, len) & mask;
+    while (pool->slots[slot] != STR_NONE) {
+        if (pooled_equals(pool, pool->slots[slot], str, len)) return pool->slots[slot];  // Already stored
+        slot = (slot + 1) & mask;
+    }
+
+    // New string: append it (refs are 32-bit, so the pool tops out just under 4 GiB)
+    if (len + 1 > (size_t)STR_NONE - pool->used) return STR_NONE;
+    if (pool->used + len + 1 > pool->cap) {
+        size_t cap = pool->cap < MIN_DATA ? MIN_DATA : pool->cap * 2;
+        while (cap < pool->used + len + 1) cap *= 2;
+        if (cap > STR_NONE) cap = STR_NONE;
+        char *data = realloc(pool->data, cap);
+        if (data == NULL) return STR_NONE;
+        pool->data = data;
+        pool->cap = cap;
+    }
+    StrRef ref = (StrRef)pool->used;
+    memcpy(pool->data + ref, str, len);
+    pool->data[ref + len] = '\0';
+    pool->used += len + 1;
+    pool->slots[slot] = ref;
+    pool->count++;
+    return ref;
+}
+
+StrRef string_pool_intern(StringPool *pool, const char *str) {
+    return string_pool_intern_n(pool, str, strlen(str));
+}
+
+StrRef string_pool_find(const StringPool *pool, const char *str) {
+    if (pool->slot_count == 0) return STR_NONE;
+    size_t len = strlen(str);
+    size_t mask = pool->slot_count - 1;
+    for (size_t slot = (size_t)hash_string(str, len) & mask; pool->slots[slot] != STR_NONE; slot = (slot + 1) & mask) {
+        if (pooled_equals(pool, pool->slots[slot], str, len)) return pool->slots[slot];
+    }
+    return STR_NONE;
+}
@@ -0,0 +1,63 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// STRING POOL (INTERNING)
+// =======================
+// Instead of a char[50] inside every record, all strings live back to back
+// in ONE growing buffer and records keep a 4-byte StrRef (an offset into it):
+//
+//   data: "Toyota\0Camry\0Honda\0Civic\0..."
+//           ^0      ^7     ^13    ^19
+//
+// - Each distinct string is stored ONCE ("interning"): 1 million cars made by
+//   "Toyota" all point at the same 7 bytes
+// - Equal strings get equal refs, so comparing two interned strings is
+//   comparing two integers - no strcmp
+// - Refs stay valid when the buffer grows (they are offsets, not pointers)
+//
+//   StringPool pool;
+//   string_pool_init(&pool);
+//   StrRef ref = string_pool_intern(&pool, "Toyota");
+//   printf("%s\n", string_pool_get(&pool, ref));
+//   string_pool_destroy(&pool);
+//
+// Build: gcc -O2 -o program your_file.c string_pool.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t StrRef;
+#define STR_NONE UINT32_MAX   // Not found / out of memory
+
+typedef struct {
+    char *data;         // NUL-terminated strings, back to back
+    size_t used;
+    size_t cap;
+    StrRef *slots;      // Hash table of refs for interning (STR_NONE = empty)
+    size_t slot_count;  // Power of 2
+    size_t count;       // Distinct strings stored
+} StringPool;
+
+void string_pool_init(StringPool *pool);
+void string_pool_destroy(StringPool *pool);
+
+// Ref of the (only) copy of str, adding it if new. STR_NONE if out of memory
+StrRef string_pool_intern(StringPool *pool, const char *str);
+StrRef string_pool_intern_n(StringPool *pool, const char *str, size_t len);  // First len chars
+
+// Ref of str if it is already in the pool, else STR_NONE (never adds)
+StrRef string_pool_find(const StringPool *pool, const char *str);
+
+static inline const char* string_pool_get(const StringPool *pool, StrRef ref) {
+    return pool->data + ref;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
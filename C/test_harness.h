@@ -0,0 +1,303 @@
+#ifndef TEST_HARNESS_H
+#define TEST_HARNESS_H
+
+// Include this FIRST: clock_gettime needs the POSIX feature macro before any system header
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// MINIMAL TEST + BENCHMARK HARNESS
+// ================================
+// Header-only: a test file includes it, defines TESTs and BENCHes, and ends
+// with HARNESS_MAIN(). Tests register themselves (a constructor function runs
+// before main), so there is no list to keep in sync.
+//
+//   #include "test_harness.h"
+//   #include "darray.h"
+//
+//   TEST(push_grows) {
+//       DynamicArray *arr = array_create(sizeof(int), 1, NULL);
+//       REQUIRE(arr != NULL);              // Stops this test if it fails
+//       int x = 7;
+//       CHECK_EQ(array_push(arr, &x), 0);  // Records the failure, keeps going
+//       array_free(arr);
+//   }
+//
+//   BENCH(push_1000, 1000) {               // 1000 operations per call
+//       ... bench_start(b) / bench_stop(b) optionally mark the timed part
+//   }
+//
+//   HARNESS_MAIN()
+//
+// Running:   ./program                 tests only (exit code 1 if any fail)
+//            ./program --bench         tests, then benchmarks
+//            ./program --bench-only    benchmarks only
+// Options:   --filter TEXT    only names containing TEXT
+//            --warmup N       untimed calls before measuring (default 3)
+//            --reps N         timed calls per benchmark (default 31)
+//            --save FILE      write "name median_ns_per_op" lines
+//            --compare FILE   compare with a saved file: exit code 1 if a median is
+//            --tolerance P    more than P percent slower (default 10)
+//
+// Benchmarks report the median and p99 over the timed calls (per operation),
+// and cycles/op from an estimated clock speed (set HARNESS_GHZ to override).
+//
+// Build: gcc -O2 -o program your_test.c [module .c files] -lm
+
+#define HARNESS_MAX_CASES 256
+#define HARNESS_MAX_REPS 10001
+
+// ===== REGISTRATION =====
+
+typedef struct {
+    double start;
+    double elapsed;
+    int stopped;
+} Bench;
+
+typedef struct {
+    const char *name;
+    void (*test)(void);
+    void (*bench)(Bench *b);
+    size_t ops;                 // Operations per bench call
+} HarnessCase;
+
+static HarnessCase harness_cases[HARNESS_MAX_CASES];
+static int harness_case_count;
+static int harness_current_failed;
+
+static inline void harness_register(const char *name, void (*test)(void), void (*bench)(Bench*), size_t ops) {
+    if (harness_case_count == HARNESS_MAX_CASES) {
+        fprintf(stderr, "test_harness: more than %d cases\n", HARNESS_MAX_CASES);
+        exit(2);
+    }
+    harness_cases[harness_case_count++] = (HarnessCase){name, test, bench, ops ? ops : 1};
+}
+
+#define TEST(name)                                                           \
+    static void test_##name(void);                                           \
+    __attribute__((constructor)) static void harness_add_test_##name(void) { \
+        harness_register(#name, test_##name, NULL, 0);                       \
+    }                                                                        \
+    static void test_##name(void)
+
+#define BENCH(name, ops)                                                      \
+    static void bench_##name(__attribute__((unused)) Bench *b);               \
+    __attribute__((constructor)) static void harness_add_bench_##name(void) { \
+        harness_register(#name, NULL, bench_##name, (ops));                   \
+    }                                                                         \
+    static void bench_##name(__attribute__((unused)) Bench *b)
+
+// ===== ASSERTIONS =====
+// CHECK_* record a failure and continue; REQUIRE returns from the test
+
+static inline int harness_fail(const char *file, int line, const char *what) {
+    printf("    %s:%d: %s\n", file, line, what);
+    harness_current_failed = 1;
+    return 0;
+}
+
+#define CHECK(cond) ((cond) ? 1 : harness_fail(__FILE__, __LINE__, "CHECK(" #cond ") failed"))
+
+#define REQUIRE(cond)       \
+    do {                    \
+        if (!CHECK(cond)) { \
+            return;         \
+        }                   \
+    } while (0)
+
+// Integers of any type (compared as long long)
+#define CHECK_EQ(a, b)                                                                 \
+    do {                                                                               \
+        long long a_ = (long long)(a), b_ = (long long)(b);                            \
+        if (a_ != b_) {                                                                \
+            char msg_[256];                                                            \
+            snprintf(msg_, sizeof msg_, "CHECK_EQ(%s, %s): %lld != %lld", #a, #b, a_, b_); \
+            harness_fail(__FILE__, __LINE__, msg_);                                    \
+        }                                                                              \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps)                                                          \
+    do {                                                                               \
+        double a_ = (double)(a), b_ = (double)(b);                                     \
+        if (!(fabs(a_ - b_) <= (eps))) {                                               \
+            char msg_[256];                                                            \
+            snprintf(msg_, sizeof msg_, "CHECK_NEAR(%s, %s): %g vs %g", #a, #b, a_, b_); \
+            harness_fail(__FILE__, __LINE__, msg_);                                    \
+        }                                                                              \
+    } while (0)
+
+#define CHECK_STR_EQ(a, b)                                                                \
+    do {                                                                                  \
+        const char *a_ = (a), *b_ = (b);                                                  \
+        if (strcmp(a_, b_) != 0) {                                                        \
+            char msg_[256];                                                               \
+            snprintf(msg_, sizeof msg_, "CHECK_STR_EQ(%s, %s): \"%.80s\" != \"%.80s\"", #a, #b, a_, b_); \
+            harness_fail(__FILE__, __LINE__, msg_);                                       \
+        }                                                                                 \
+    } while (0)
+
+#define CHECK_MEM_EQ(a, b, n) \
+    (memcmp((a), (b), (n)) == 0 ? 1 : harness_fail(__FILE__, __LINE__, "CHECK_MEM_EQ(" #a ", " #b ") differs"))
+
+// ===== BENCHMARK HELPERS =====
+
+static inline double harness_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Call inside a BENCH to time only part of it (setup before start, cleanup after stop)
+static inline void bench_start(Bench *b) { b->start = harness_now(); }
+static inline void bench_stop(Bench *b) {
+    b->elapsed = harness_now() - b->start;
+    b->stopped = 1;
+}
+
+// Stops the compiler from deleting work whose result is never used
+static inline void bench_keep(const void *p) { __asm__ volatile("" : : "r"(p) : "memory"); }
+static inline void bench_keep_u64(uint64_t x) { __asm__ volatile("" : : "r"(x)); }
+
+static inline int harness_compare_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Clock speed estimate: a chain of dependent adds runs at one add per cycle
+static inline double harness_ghz(void) {
+    const char *env = getenv("HARNESS_GHZ");
+    if (env && atof(env) > 0) return atof(env);
+    const uint64_t n = 20000000;
+    double best = 1e30;
+    for (int round = 0; round < 3; round++) {
+        uint64_t x = 0;
+        double start = harness_now();
+        for (uint64_t i = 0; i < n; i++) {
+            x += 1;
+            __asm__ volatile("" : "+r"(x));   // Keeps the add (and its 1-cycle latency) in the loop
+        }
+        double seconds = harness_now() - start;
+        bench_keep_u64(x);
+        if (seconds < best) best = seconds;
+    }
+    return n / best / 1e9;
+}
+
+// ===== RUNNER =====
+
+typedef struct {
+    int run_tests, run_benches;
+    const char *filter;
+    int warmup, reps;
+    const char *save, *compare;
+    double tolerance;
+} HarnessOptions;
+
+static inline double harness_time_call(const HarnessCase *c) {
+    Bench b = {0, 0, 0};
+    b.start = harness_now();
+    c->bench(&b);
+    if (!b.stopped) b.elapsed = harness_now() - b.start;
+    return b.elapsed;
+}
+
+// Median ns/op of `name` in a saved file, or -1 if not there
+static inline double harness_baseline(const char *file, const char *name) {
+    FILE *f = file ? fopen(file, "r") : NULL;
+    if (!f) return -1;
+    char saved[128];
+    double median, found = -1;
+    while (fscanf(f, "%127s %lf", saved, &median) == 2) {
+        if (strcmp(saved, name) == 0) found = median;
+    }
+    fclose(f);
+    return found;
+}
+
+// Returns 1 if the benchmark regressed past the tolerance
+static inline int harness_run_bench(const HarnessCase *c, const HarnessOptions *opt, double ghz, FILE *save) {
+    static double per_op[HARNESS_MAX_REPS];
+    for (int i = 0; i < opt->warmup; i++) harness_time_call(c);
+    for (int i = 0; i < opt->reps; i++) per_op[i] = harness_time_call(c) / (double)c->ops * 1e9;
+    qsort(per_op, (size_t)opt->reps, sizeof(double), harness_compare_double);
+    double median = per_op[opt->reps / 2];
+    double p99 = per_op[(opt->reps * 99) / 100];
+
+    printf("  %-28s median %10.2f ns/op  p99 %10.2f ns/op  %8.1f cycles/op", c->name, median, p99, median * ghz);
+    if (save) fprintf(save, "%s %.6g\n", c->name, median);
+
+    int regressed = 0;
+    double baseline = harness_baseline(opt->compare, c->name);
+    if (baseline > 0) {
+        double change = (median / baseline - 1) * 100;
+        regressed = change > opt->tolerance;
+        printf("  %+6.1f%%%s", change, regressed ? "  REGRESSION" : "");
+    }
+    printf("\n");
+    return regressed;
+}
+
+static inline int harness_main(int argc, char *argv[]) {
+    HarnessOptions opt = {1, 0, NULL, 3, 31, NULL, NULL, 10.0};
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--bench") == 0) opt.run_benches = 1;
+        else if (strcmp(arg, "--bench-only") == 0) opt.run_tests = 0, opt.run_benches = 1;
+        else if (strcmp(arg, "--filter") == 0 && value) opt.filter = value, i++;
+        else if (strcmp(arg, "--warmup") == 0 && value) opt.warmup = atoi(value), i++;
+        else if (strcmp(arg, "--reps") == 0 && value) opt.reps = atoi(value), i++;
+        else if (strcmp(arg, "--save") == 0 && value) opt.save = value, i++;
+        else if (strcmp(arg, "--compare") == 0 && value) opt.compare = value, i++;
+        else if (strcmp(arg, "--tolerance") == 0 && value) opt.tolerance = atof(value), i++;
+        else {
+            fprintf(stderr, "unknown option %s (see test_harness.h)\n", arg);
+            return 2;
+        }
+    }
+    if (opt.warmup < 0) opt.warmup = 0;
+    if (opt.reps < 1) opt.reps = 1;
+    if (opt.reps > HARNESS_MAX_REPS) opt.reps = HARNESS_MAX_REPS;
+
+    int tests = 0, failed = 0, regressions = 0;
+    if (opt.run_tests) {
+        for (int i = 0; i < harness_case_count; i++) {
+            const HarnessCase *c = &harness_cases[i];
+            if (!c->test || (opt.filter && !strstr(c->name, opt.filter))) continue;
+            harness_current_failed = 0;
+            c->test();
+            printf("%-4s %s\n", harness_current_failed ? "FAIL" : "ok", c->name);
+            tests++;
+            failed += harness_current_failed;
+        }
+        printf("%d tests, %d failed\n", tests, failed);
+    }
+
+    if (opt.run_benches) {
+        FILE *save = opt.save ? fopen(opt.save, "w") : NULL;
+        if (opt.save && !save) perror(opt.save);
+        double ghz = harness_ghz();
+        printf("\nbenchmarks (%d warmup + %d timed calls, ~%.2f GHz):\n", opt.warmup, opt.reps, ghz);
+        for (int i = 0; i < harness_case_count; i++) {
+            const HarnessCase *c = &harness_cases[i];
+            if (!c->bench || (opt.filter && !strstr(c->name, opt.filter))) continue;
+            regressions += harness_run_bench(c, &opt, ghz, save);
+        }
+        if (save) fclose(save);
+        if (opt.compare) printf("%d regression(s) over %.0f%%\n", regressions, opt.tolerance);
+    }
+    return failed || regressions ? 1 : 0;
+}
+
+#define HARNESS_MAIN() \
+    int main(int argc, char *argv[]) { return harness_main(argc, argv); }
+
+#endif
@@ -0,0 +1,117 @@
+#include "tiled_loops.h"
+
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// ===== TILE ITERATION =====
+
+void tile_for_each(size_t rows, size_t cols, size_t tile_rows, size_t tile_cols, TileFn fn, void *ctx) {
+    if (tile_rows == 0) tile_rows = rows;
+    if (tile_cols == 0) tile_cols = cols;
+    Tile tile;
+    for (tile.row_begin = 0; tile.row_begin < rows; tile.row_begin += tile_rows) {
+        tile.row_end = TILE_END(tile.row_begin, tile_rows, rows);
+        for (tile.col_begin = 0; tile.col_begin < cols; tile.col_begin += tile_cols) {
+            tile.col_end = TILE_END(tile.col_begin, tile_cols, cols);
+            fn(&tile, ctx);
+        }
+    }
+}
+
+size_t tile_default(size_t elem_size) {
+    long l1 = 0;
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+    l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);   // glibc only; 0 or -1 if unknown
+#endif
+    if (l1 <= 0) l1 = 32 * 1024;            // Typical L1d (Apple M-series: 64-128 KB)
+    if (elem_size == 0) elem_size = 1;
+
+    // Largest power of 2 with two T x T tiles in at most half of L1
+    // (the other half is left for everything else the loop touches)
+    size_t tile = 8;
+    while (2 * (tile * 2) * (tile * 2) * elem_size <= (size_t)l1 / 2) tile *= 2;
+    return tile;
+}
+
+// ===== TRANSPOSE =====
+
+void transpose_naive(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols) {
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+            dst[j * rows + i] = src[i * cols + j];
+        }
+    }
+}
+
+// Transposes the block src[r0..r1) x [c0..c1) into dst
+static void transpose_block(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols,
+                            size_t r0, size_t r1, size_t c0, size_t c1) {
+    size_t i = r0;
+#ifdef __SSE2__
+    // 4x4 at a time in registers: 4 loads along src rows, shuffle,
+    // 4 stores along dst rows - no element is ever accessed down a column
+    for (; i + 4 <= r1; i += 4) {
+        size_t j = c0;
+        for (; j + 4 <= c1; j += 4) {
+            const uint32_t *s = src + i * cols + j;
+            __m128i a = _mm_loadu_si128((const __m128i*)s);
+            __m128i b = _mm_loadu_si128((const __m128i*)(s + cols));
+            __m128i c = _mm_loadu_si128((const __m128i*)(s + 2 * cols));
+            __m128i d = _mm_loadu_si128((const __m128i*)(s + 3 * cols));
+            __m128i ab_lo = _mm_unpacklo_epi32(a, b);   // a0 b0 a1 b1
+            __m128i ab_hi = _mm_unpackhi_epi32(a, b);   // a2 b2 a3 b3
+            __m128i cd_lo = _mm_unpacklo_epi32(c, d);   // c0 d0 c1 d1
+            __m128i cd_hi = _mm_unpackhi_epi32(c, d);   // c2 d2 c3 d3
+            uint32_t *t = dst + j * rows + i;
+            _mm_storeu_si128((__m128i*)t, _mm_unpacklo_epi64(ab_lo, cd_lo));              // a0 b0 c0 d0
+            _mm_storeu_si128((__m128i*)(t + rows), _mm_unpackhi_epi64(ab_lo, cd_lo));     // a1 b1 c1 d1
+            _mm_storeu_si128((__m128i*)(t + 2 * rows), _mm_unpacklo_epi64(ab_hi, cd_hi)); // a2 b2 c2 d2
+            _mm_storeu_si128((__m128i*)(t + 3 * rows), _mm_unpackhi_epi64(ab_hi, cd_hi)); // a3 b3 c3 d3
+        }
+        for (; j < c1; j++) {   // Leftover columns
+            for (size_t k = i; k < i + 4; k++) dst[j * rows + k] = src[k * cols + j];
+        }
+    }
+#endif
+    for (; i < r1; i++) {       // Leftover rows (or all of them without SSE2)
+        for (size_t j = c0; j < c1; j++) {
+            dst[j * rows + i] = src[i * cols + j];
+        }
+    }
+}
+
+void transpose_tiled(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols, size_t tile) {
+    if (tile == 0) tile = tile_default(sizeof(uint32_t));
+    for (size_t r0 = 0; r0 < rows; r0 += tile) {
+        size_t r1 = TILE_END(r0, tile, rows);
+        for (size_t c0 = 0; c0 < cols; c0 += tile) {
+            transpose_block(src, dst, rows, cols, r0, r1, c0, TILE_END(c0, tile, cols));
+        }
+    }
+}
+
+#define RECURSIVE_LEAF 32   // Blocks this small (32 x 32 x 4 bytes = 4 KB) fit any L1
+
+static void transpose_split(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols,
+                            size_t r0, size_t r1, size_t c0, size_t c1) {
+    size_t height = r1 - r0, width = c1 - c0;
+    if (height <= RECURSIVE_LEAF && width <= RECURSIVE_LEAF) {
+        transpose_block(src, dst, rows, cols, r0, r1, c0, c1);
+    } else if (height >= width) {
+        size_t mid = r0 + height / 2;
+        transpose_split(src, dst, rows, cols, r0, mid, c0, c1);
+        transpose_split(src, dst, rows, cols, mid, r1, c0, c1);
+    } else {
+        size_t mid = c0 + width / 2;
+        transpose_split(src, dst, rows, cols, r0, r1, c0, mid);
+        transpose_split(src, dst, rows, cols, r0, r1, mid, c1);
+    }
+}
+
+void transpose_recursive(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols) {
+    if (rows == 0 || cols == 0) return;
+    transpose_split(src, dst, rows, cols, 0, rows, 0, cols);
+}
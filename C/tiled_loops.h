@@ -0,0 +1,81 @@
+#ifndef TILED_LOOPS_H
+#define TILED_LOOPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// TILED (BLOCKED) 2D LOOPS
+// ========================
+// c10_loops.c walks a grid with two nested loops: all of row 0, then all of row 1...
+// Fine when every access is along a row. But an operation like transpose
+// reads rows and writes COLUMNS:
+//
+//   dst[j][i] = src[i][j]    - each write lands in a different row of dst
+//
+// With 4096 columns, consecutive writes are 16 KB apart: every write touches
+// a new cache line, and by the time the loop comes back to that line it has
+// been evicted. The CPU ends up moving ~16x more memory than needed.
+//
+// Tiling: split the grid into small T x T tiles and finish one tile before
+// moving on. A tile of src and a tile of dst both fit in cache, so every
+// cache line loaded is fully used before it is evicted.
+//
+//   Naive order:            Tiled order (T = 2):
+//   1  2  3  4              1  2 | 5  6
+//   5  6  7  8              3  4 | 7  8
+//   9 10 11 12              -----+-----
+//  13 14 15 16              9 10 |13 14
+//                          11 12 |15 16
+//
+//   TILED_FOR_2D(i, j, rows, cols, 64) {
+//       dst[j * rows + i] = src[i * cols + j];
+//   }
+//
+// Build: gcc -O2 -o program your_file.c tiled_loops.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TILE_END(start, tile, limit) ((start) + (tile) < (limit) ? (start) + (tile) : (limit))
+
+// Visits every (i, j) with 0 <= i < rows, 0 <= j < cols, one tile at a time.
+// Note: `break` in the body only leaves the innermost (j) loop
+#define TILED_FOR_2D(i, j, rows, cols, tile)                                  \
+    for (size_t i##_tile = 0; i##_tile < (rows); i##_tile += (tile))          \
+        for (size_t j##_tile = 0; j##_tile < (cols); j##_tile += (tile))      \
+            for (size_t i = i##_tile; i < TILE_END(i##_tile, tile, rows); i++) \
+                for (size_t j = j##_tile; j < TILE_END(j##_tile, tile, cols); j++)
+
+// ===== CALLBACK VERSION =====
+// fn is called once per TILE (not per element), so the call costs nothing
+
+typedef struct {
+    size_t row_begin, row_end;   // Rows [row_begin, row_end)
+    size_t col_begin, col_end;   // Columns [col_begin, col_end)
+} Tile;
+
+typedef void (*TileFn)(const Tile *tile, void *ctx);
+
+void tile_for_each(size_t rows, size_t cols, size_t tile_rows, size_t tile_cols, TileFn fn, void *ctx);
+
+// A square tile size (power of 2) so that one source and one destination
+// tile of elem_size-byte elements fit in the L1 data cache together
+size_t tile_default(size_t elem_size);
+
+// ===== TRANSPOSE =====
+// dst (cols x rows) = transpose of src (rows x cols), row-major, 4-byte
+// elements (int32_t, uint32_t or float). src and dst must not overlap
+
+void transpose_naive(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols);
+void transpose_tiled(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols, size_t tile);
+
+// Cache-oblivious: halve the longer side until blocks are small.
+// No tile size to tune - it adapts to every cache level at once
+void transpose_recursive(const uint32_t *src, uint32_t *dst, size_t rows, size_t cols);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
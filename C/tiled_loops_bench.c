@@ -0,0 +1,118 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tiled_loops.h"
+
+// TILED LOOPS BENCHMARK
+// =====================
+// Transposes N x N matrices of 4-byte elements for N = 1024, 2048, ... up to max_n,
+// with the plain nested loops from c10_loops.c, the cache-oblivious version,
+// TILED_FOR_2D and transpose_tiled at every tile size from 8 to 256.
+// Prints GB/s (bytes read + written) - pick the best tile size for this machine.
+//
+// Memory: two N x N arrays = 8 * N * N bytes (2 GB at N = 16384), so max_n is
+// an argument: ./program 4096 stops at 4096 x 4096.
+//
+// Build: gcc -O2 -o program tiled_loops_bench.c tiled_loops.c && ./program [max_n]
+
+#define MIN_TILE 8
+#define MAX_TILE 256
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// src[i][j] holds its own index, so dst[k] must be index (k % n) * n + k / n.
+// Checks dst in order: cheap even for huge matrices
+static int check_transposed(const uint32_t *dst, size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        for (size_t i = 0; i < n; i++) {
+            if (dst[j * n + i] != (uint32_t)(i * n + j)) return 0;
+        }
+    }
+    return 1;
+}
+
+static void transpose_macro(const uint32_t *src, uint32_t *dst, size_t n, size_t tile) {
+    TILED_FOR_2D(i, j, n, n, tile) {
+        dst[j * n + i] = src[i * n + j];
+    }
+}
+
+enum { NAIVE = -1, RECURSIVE = -2, MACRO = -3 };
+
+// Best-of-3 GB/s for one method (tile > 0: transpose_tiled with that tile)
+static double measure(int method, const uint32_t *src, uint32_t *dst, size_t n, int *ok) {
+    // Repeat small matrices so every measurement moves at least ~512 MB
+    size_t reps = ((size_t)1 << 26) / (n * n);
+    if (reps == 0) reps = 1;
+    double best = 1e30;
+    for (int round = 0; round < 3; round++) {
+        double start = now_sec();
+        for (size_t r = 0; r < reps; r++) {
+            if (method == NAIVE) transpose_naive(src, dst, n, n);
+            else if (method == RECURSIVE) transpose_recursive(src, dst, n, n);
+            else if (method == MACRO) transpose_macro(src, dst, n, 32);
+            else transpose_tiled(src, dst, n, n, (size_t)method);
+        }
+        double seconds = (now_sec() - start) / reps;
+        if (seconds < best) best = seconds;
+    }
+    *ok &= check_transposed(dst, n);
+    memset(dst, 0, n * n * sizeof(uint32_t));   // The next method can't pass by accident
+    return 2.0 * n * n * sizeof(uint32_t) / best / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    size_t max_n = argc > 1 ? strtoull(argv[1], NULL, 10) : 16384;
+    if (max_n < 1024) max_n = 1024;
+
+    printf("transpose, N x N uint32, GB/s (higher is better)\n");
+    printf("tile_default(4) on this machine: %zu\n\n", tile_default(sizeof(uint32_t)));
+    printf("%6s %7s %7s %7s", "N", "naive", "recurs", "macro32");
+    for (size_t tile = MIN_TILE; tile <= MAX_TILE; tile *= 2) printf(" %6zu", tile);
+    printf("   best tile\n");
+
+    int ok = 1;
+    for (size_t n = 1024; n <= max_n; n *= 2) {
+        uint32_t *src = malloc(n * n * sizeof(uint32_t));
+        uint32_t *dst = malloc(n * n * sizeof(uint32_t));
+        if (!src || !dst) {
+            printf("%6zu  not enough memory (%zu MB)\n", n, 2 * n * n * sizeof(uint32_t) >> 20);
+            free(src);
+            free(dst);
+            break;
+        }
+        for (size_t k = 0; k < n * n; k++) src[k] = (uint32_t)k;
+        memset(dst, 0, n * n * sizeof(uint32_t));   // Page faults now, not in the timings
+
+        printf("%6zu", n);
+        printf(" %7.2f", measure(NAIVE, src, dst, n, &ok));
+        printf(" %7.2f", measure(RECURSIVE, src, dst, n, &ok));
+        printf(" %7.2f", measure(MACRO, src, dst, n, &ok));
+        fflush(stdout);
+        size_t best_tile = 0;
+        double best_rate = 0;
+        for (size_t tile = MIN_TILE; tile <= MAX_TILE; tile *= 2) {
+            double rate = measure((int)tile, src, dst, n, &ok);
+            printf(" %6.2f", rate);
+            fflush(stdout);
+            if (rate > best_rate) {
+                best_rate = rate;
+                best_tile = tile;
+            }
+        }
+        printf("   %zu\n", best_tile);
+
+        free(src);
+        free(dst);
+    }
+
+    printf("\n%s\n", ok ? "all versions agree" : "MISMATCH between versions!");
+    return 0;
+}